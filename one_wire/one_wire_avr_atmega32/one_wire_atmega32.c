@@ -0,0 +1,906 @@
+/*********************************************************************************************************************
+* Author : Alsayed Alsisi
+* Date   : Thursday, May 06, 2021
+* Version: 1.0
+* Contact: alsayed.alsisi@gmail.com
+* License:
+* You have the right to use the file as you wish in any educational or commercial purposes under the following
+* conditions:
+* [1] This file is to be used as is. No modifications are to be made to any part of the file, including this section.
+* [2] This section is not to be removed under any circumstances.
+* [3] Parts of the file may be used separately under the condition they are not modified, and preceded by this section.
+* [4] Any bug encountered in this file or parts of it should be reported to the email address given above to be fixed.
+* [5] No warranty is expressed or implied by the publication or distribution of this source code.
+*********************************************************************************************************************/
+/*********************************************************************************************************************
+* File Information:
+** File Name:
+*  one_wire_atmega32.c
+*
+** Description:
+*  This file contains the implementation of the 1-Wire bus master of the atmega32 microcontroller.
+*********************************************************************************************************************/
+
+
+/*********************************************************************************************************************
+                                               << File Inclusions >>
+*********************************************************************************************************************/
+#include "one_wire_config.h"  /* Note: It also contains the definition of F_CPU required for the timing. */
+#include <util/delay.h>
+#include <util/atomic.h>
+#include <util/crc16.h>
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <stdint.h>
+#include <stddef.h>
+#include "one_wire_atmega32.h"
+#include "gpio_atmega32.h"
+#include "bit_math.h"
+
+/*********************************************************************************************************************
+                                              << Private Constants >>
+*********************************************************************************************************************/
+#define   INITIALIZE_TO_ZERO               (0U)
+
+#if ((F_CPU < 12000000UL) || (F_CPU > 20000000UL))
+#error "F_CPU in one_wire_config.h needs to be from 12 MHz to 20 MHz"
+#endif
+
+/* Standard speed timing in micro seconds. The reset phases use the slower Timer2 clock, since they're longer: */
+#define   ONE_WIRE_RESET_LOW_US            (480UL)
+#define   ONE_WIRE_PRESENCE_SAMPLE_US      (70UL)    /* From the release of the reset pulse */
+#define   ONE_WIRE_RESET_RECOVERY_US       (410UL)   /* From the presence sample to the end of the reset */
+#define   ONE_WIRE_SLOT_LOW_US             (2U)      /* Low time of a write 1 slot and a read slot */
+#define   ONE_WIRE_READ_SAMPLE_US          (12UL)    /* From the start of the slot to the pin read */
+#define   ONE_WIRE_READ_RECOVERY_US        (55UL)    /* From the sample to the end of the slot */
+#define   ONE_WIRE_WRITE_0_LOW_US          (60UL)
+#define   ONE_WIRE_WRITE_0_RECOVERY_US     (10UL)
+#define   ONE_WIRE_FIRST_SLOT_DELAY_US     (10UL)    /* From the operation start to its first slot */
+
+#define   ONE_WIRE_BYTE_BITS               (8U)
+#define   ONE_WIRE_ROM_BITS                (64U)
+#define   ONE_WIRE_DATA_MSB                (0x80U)
+
+#define   TIMER2_SLOT_PRESCALER            (8UL)
+#define   TIMER2_RESET_PRESCALER           (64UL)
+#define   TIMER2_CTC_PRESCALER_8           ((1<<WGM21)|(1<<CS21))
+#define   TIMER2_CTC_PRESCALER_64          ((1<<WGM21)|(1<<CS22))
+#define   TIMER2_STOPPED                   (0x00)
+/* Converts a time in micro seconds to Timer2 ticks, rounding up. The compare match period is OCR2 + 1 ticks, so the
+   values are written to OCR2 minus one: */
+#define   ONE_WIRE_SLOT_TICKS(TIME_US)     ((uint8_t)((((F_CPU/1000000UL)*(TIME_US)) + TIMER2_SLOT_PRESCALER - 1UL) / TIMER2_SLOT_PRESCALER))
+#define   ONE_WIRE_RESET_TICKS(TIME_US)    ((uint8_t)((((F_CPU/1000000UL)*(TIME_US)) + TIMER2_RESET_PRESCALER - 1UL) / TIMER2_RESET_PRESCALER))
+/* Estimated CPU cycles from a compare match to the pin read: the interrupt response, the prologue saving the registers
+   used by the callback call, and the phase dispatch. The sample compare match comes that much earlier, rounding down: */
+#define   ONE_WIRE_SAMPLE_ENTRY_CYCLES     (56UL)
+#define   ONE_WIRE_SAMPLE_TICKS            ((uint8_t)((((F_CPU/1000000UL)*ONE_WIRE_READ_SAMPLE_US) - ONE_WIRE_SAMPLE_ENTRY_CYCLES) / TIMER2_SLOT_PRESCALER))
+
+/* Pin mask of the bus pin, which is constant so the bus is driven with sbi and cbi: */
+#define   ONE_WIRE_PIN_MASK                ((uint8_t)(1U << ONE_WIRE_PIN))
+
+/*********************************************************************************************************************
+                                              << Private Data Types >>
+*********************************************************************************************************************/
+typedef enum
+{
+	ONE_WIRE_OPERATION_RESET = 0,
+	ONE_WIRE_OPERATION_BYTE,         /* Write or read: a read writes 0xFF, and collects the bits the devices pull low */
+	ONE_WIRE_OPERATION_SEARCH
+	} one_wire_operation_t;
+
+/* Action of the next Timer2 compare match: */
+typedef enum
+{
+	ONE_WIRE_PHASE_RESET_RELEASE = 0,
+	ONE_WIRE_PHASE_PRESENCE_SAMPLE,
+	ONE_WIRE_PHASE_RESET_END,
+	ONE_WIRE_PHASE_SLOT_START,
+	ONE_WIRE_PHASE_SLOT_RELEASE,     /* End of the low time of a write 0 slot */
+	ONE_WIRE_PHASE_SLOT_SAMPLE,
+	ONE_WIRE_PHASE_SLOT_END
+	} one_wire_phase_t;
+
+/* Search ROM steps after the reset: */
+typedef enum
+{
+	ONE_WIRE_SEARCH_COMMAND = 0,
+	ONE_WIRE_SEARCH_ID_BIT,
+	ONE_WIRE_SEARCH_COMPLEMENT_BIT,
+	ONE_WIRE_SEARCH_DIRECTION_BIT
+	} one_wire_search_step_t;
+
+/*********************************************************************************************************************
+                                          << Private Variable Definitions >>
+*********************************************************************************************************************/
+static volatile uint8_t g_one_wire_busy = INITIALIZE_TO_ZERO;
+static volatile one_wire_result_t g_one_wire_result = ONE_WIRE_RESULT_DONE;
+static void (*g_one_wire_complete_callback)(void) = NULL;
+static one_wire_operation_t g_one_wire_operation = ONE_WIRE_OPERATION_RESET;
+static one_wire_phase_t g_one_wire_phase = ONE_WIRE_PHASE_RESET_RELEASE;
+
+/* Time slots: */
+static uint8_t g_one_wire_data = INITIALIZE_TO_ZERO;         /* Bits to write, LSB first, and the read bits */
+static uint8_t g_one_wire_bits_left = INITIALIZE_TO_ZERO;
+static uint8_t g_one_wire_read_bit = INITIALIZE_TO_ZERO;
+static uint8_t g_one_wire_presence = INITIALIZE_TO_ZERO;
+static volatile uint8_t g_one_wire_read_data = INITIALIZE_TO_ZERO;
+
+/* ROM search, kept from one search to the next: */
+static uint8_t g_one_wire_rom[ONE_WIRE_ROM_SIZE];
+static uint8_t g_one_wire_last_discrepancy = INITIALIZE_TO_ZERO;   /* Bit number (1 to 64) of the last zero branch */
+static uint8_t g_one_wire_last_device_found = INITIALIZE_TO_ZERO;
+static volatile uint8_t g_one_wire_rom_valid = INITIALIZE_TO_ZERO;
+
+/* ROM search, for the current search: */
+static one_wire_search_step_t g_one_wire_search_step = ONE_WIRE_SEARCH_COMMAND;
+static uint8_t g_one_wire_search_bit_number = INITIALIZE_TO_ZERO;   /* ROM bits done */
+static uint8_t g_one_wire_search_id_bit = INITIALIZE_TO_ZERO;
+static uint8_t g_one_wire_search_last_zero = INITIALIZE_TO_ZERO;
+static uint8_t g_one_wire_search_crc = ONE_WIRE_CRC8_INITIAL_VALUE;
+
+/*********************************************************************************************************************
+                                          << Public Variable Definitions >>
+*********************************************************************************************************************/
+
+
+/*********************************************************************************************************************
+                                         << Private Functions Prototypes >>
+*********************************************************************************************************************/
+static void one_wire_timer_start(uint8_t timer_control, uint8_t timer_ticks);
+static void one_wire_reset_start(void);
+static void one_wire_slots_start(uint8_t data_byte, uint8_t bit_count);
+static void one_wire_slot_begin(void);
+static void one_wire_reset_complete(void);
+static void one_wire_slot_complete(void);
+static void one_wire_search_slot_complete(void);
+static void one_wire_search_clear(void);
+static void one_wire_operation_complete(one_wire_result_t result);
+
+/*********************************************************************************************************************
+                                          << Public Function Definitions >>
+*********************************************************************************************************************/
+/*********************************************************************************************************************
+** Function Name:
+*  one_wire_init
+*
+** Description:
+*  This function stops Timer2, and configures the bus pin as an input without the pull-up resistor. Its PORT bit stays
+*  low, so making the pin an output pulls the bus low.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+void one_wire_init(void)
+{
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		TCCR2 = TIMER2_STOPPED;
+		BIT_CLEAR(TIMSK, OCIE2);
+		(void)gpio_pin_config(ONE_WIRE_PORT, ONE_WIRE_PIN, GPIO_INPUT, GPIO_PIN_LOW);
+		g_one_wire_busy = INITIALIZE_TO_ZERO;
+		g_one_wire_result = ONE_WIRE_RESULT_DONE;
+		g_one_wire_rom_valid = INITIALIZE_TO_ZERO;
+		one_wire_search_clear();
+	}
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  one_wire_reset
+*
+** Description:
+*  This function starts a reset pulse.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - one_wire_std_error_type_t
+*    The return value returns ONE_WIRE_E_OK if the reset started, and returns "ONE_WIRE_E_NOT_OK" otherwise.
+*********************************************************************************************************************/
+one_wire_std_error_type_t one_wire_reset(void)
+{
+	one_wire_std_error_type_t return_error = ONE_WIRE_E_NOT_OK;
+
+	/* An operation can also be started by the complete callback, from the interrupt: */
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		if (INITIALIZE_TO_ZERO == g_one_wire_busy)
+		{
+			g_one_wire_busy = 1U;
+			g_one_wire_result = ONE_WIRE_RESULT_PENDING;
+			g_one_wire_operation = ONE_WIRE_OPERATION_RESET;
+			one_wire_reset_start();
+			return_error = ONE_WIRE_E_OK;
+		}
+	}
+
+	return return_error;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  one_wire_byte_write
+*
+** Description:
+*  This function starts the 8 time slots that write a byte.
+*
+** Input Parameters:
+*  - data_byte: uint8_t
+*    Passes the byte to be written.
+*
+** Return Value:
+*  - one_wire_std_error_type_t
+*    The return value returns ONE_WIRE_E_OK if the write started, and returns "ONE_WIRE_E_NOT_OK" otherwise.
+*********************************************************************************************************************/
+one_wire_std_error_type_t one_wire_byte_write(uint8_t data_byte)
+{
+	one_wire_std_error_type_t return_error = ONE_WIRE_E_NOT_OK;
+
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		if (INITIALIZE_TO_ZERO == g_one_wire_busy)
+		{
+			g_one_wire_busy = 1U;
+			g_one_wire_result = ONE_WIRE_RESULT_PENDING;
+			g_one_wire_operation = ONE_WIRE_OPERATION_BYTE;
+			one_wire_slots_start(data_byte, ONE_WIRE_BYTE_BITS);
+			return_error = ONE_WIRE_E_OK;
+		}
+	}
+
+	return return_error;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  one_wire_byte_read
+*
+** Description:
+*  This function starts the 8 read time slots of a byte. A read slot is a write 1 slot, during which a device can
+*  hold the bus low to send a 0.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - one_wire_std_error_type_t
+*    The return value returns ONE_WIRE_E_OK if the read started, and returns "ONE_WIRE_E_NOT_OK" otherwise.
+*********************************************************************************************************************/
+one_wire_std_error_type_t one_wire_byte_read(void)
+{
+	return one_wire_byte_write(0xFFU);
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  one_wire_data_get
+*
+** Description:
+*  This function returns the byte read by the last byte operation.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - uint8_t
+*    Returns the byte read.
+*********************************************************************************************************************/
+uint8_t one_wire_data_get(void)
+{
+	return g_one_wire_read_data;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  one_wire_search_first
+*
+** Description:
+*  This function clears the search state, so the search starts again from the zero branches, then starts it.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - one_wire_std_error_type_t
+*    The return value returns ONE_WIRE_E_OK if the search started, and returns "ONE_WIRE_E_NOT_OK" otherwise.
+*********************************************************************************************************************/
+one_wire_std_error_type_t one_wire_search_first(void)
+{
+	one_wire_std_error_type_t return_error = ONE_WIRE_E_NOT_OK;
+
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		if (INITIALIZE_TO_ZERO == g_one_wire_busy)
+		{
+			one_wire_search_clear();
+			return_error = one_wire_search_next();
+		}
+	}
+
+	return return_error;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  one_wire_search_next
+*
+** Description:
+*  This function starts the search of the next device with a reset pulse. The rest of the search is run by the
+*  Timer2 interrupt.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - one_wire_std_error_type_t
+*    The return value returns ONE_WIRE_E_OK if the search started, and returns "ONE_WIRE_E_NOT_OK" otherwise.
+*********************************************************************************************************************/
+one_wire_std_error_type_t one_wire_search_next(void)
+{
+	one_wire_std_error_type_t return_error = ONE_WIRE_E_NOT_OK;
+
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		if ((INITIALIZE_TO_ZERO == g_one_wire_busy) && (INITIALIZE_TO_ZERO == g_one_wire_last_device_found))
+		{
+			g_one_wire_busy = 1U;
+			g_one_wire_result = ONE_WIRE_RESULT_PENDING;
+			g_one_wire_operation = ONE_WIRE_OPERATION_SEARCH;
+			g_one_wire_rom_valid = INITIALIZE_TO_ZERO;
+			g_one_wire_search_bit_number = INITIALIZE_TO_ZERO;
+			g_one_wire_search_last_zero = INITIALIZE_TO_ZERO;
+			g_one_wire_search_crc = ONE_WIRE_CRC8_INITIAL_VALUE;
+			one_wire_reset_start();
+			return_error = ONE_WIRE_E_OK;
+		}
+	}
+
+	return return_error;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  one_wire_search_rom_get
+*
+** Description:
+*  This function copies the ROM code found by the last search.
+*
+** Input Parameters:
+*  - rom: uint8_t*
+*    Passes an array of ONE_WIRE_ROM_SIZE bytes for the ROM code.
+*
+** Return Value:
+*  - one_wire_std_error_type_t
+*    The return value returns ONE_WIRE_E_OK if the ROM code is copied, and returns "ONE_WIRE_E_NOT_OK" otherwise.
+*********************************************************************************************************************/
+one_wire_std_error_type_t one_wire_search_rom_get(uint8_t* rom)
+{
+	one_wire_std_error_type_t return_error = ONE_WIRE_E_NOT_OK;
+	uint8_t rom_index = INITIALIZE_TO_ZERO;
+
+	/* The ROM code only changes while a search is running, which clears the valid flag first: */
+	if ((NULL != rom) && (INITIALIZE_TO_ZERO != g_one_wire_rom_valid))
+	{
+		for (rom_index = 0; rom_index < ONE_WIRE_ROM_SIZE; rom_index++)
+		{
+			rom[rom_index] = g_one_wire_rom[rom_index];
+		}
+		return_error = ONE_WIRE_E_OK;
+	}
+
+	return return_error;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  one_wire_is_ready
+*
+** Description:
+*  This function returns whether the last operation is complete.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - one_wire_is_ready_t
+*    Returns "ONE_WIRE_READY" if no operation is running, and "ONE_WIRE_NOT_READY" otherwise.
+*********************************************************************************************************************/
+one_wire_is_ready_t one_wire_is_ready(void)
+{
+	one_wire_is_ready_t is_ready = ONE_WIRE_NOT_READY;
+
+	if (INITIALIZE_TO_ZERO == g_one_wire_busy)
+	{
+		is_ready = ONE_WIRE_READY;
+	}
+
+	return is_ready;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  one_wire_result_get
+*
+** Description:
+*  This function returns the result of the last operation.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - one_wire_result_t
+*    Returns the result.
+*********************************************************************************************************************/
+one_wire_result_t one_wire_result_get(void)
+{
+	return g_one_wire_result;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  one_wire_complete_callback_set
+*
+** Description:
+*  This function sets the callback that is called once an operation is complete.
+*
+** Input Parameters:
+*  - complete_callback: void (*)(void)
+*    Passes the address of the callback function, or NULL.
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+void one_wire_complete_callback_set(void (*complete_callback)(void))
+{
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		g_one_wire_complete_callback = complete_callback;
+	}
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  one_wire_crc8_update
+*
+** Description:
+*  This function adds a byte to a running 1-Wire CRC-8, using the avr-libc implementation.
+*
+** Input Parameters:
+*  - crc: uint8_t
+*    Passes the CRC so far.
+*  - data_byte: uint8_t
+*    Passes the next byte.
+*
+** Return Value:
+*  - uint8_t
+*    Returns the updated CRC.
+*********************************************************************************************************************/
+uint8_t one_wire_crc8_update(uint8_t crc, uint8_t data_byte)
+{
+	return _crc_ibutton_update(crc, data_byte);
+}
+
+
+/*********************************************************************************************************************
+                                          << Private Function Definitions >>
+*********************************************************************************************************************/
+/*********************************************************************************************************************
+** Function Name:
+*  one_wire_timer_start
+*
+** Description:
+*  This function restarts Timer2 in CTC mode, with its compare match interrupt firing after the given ticks.
+*
+** Input Parameters:
+*  - timer_control: uint8_t
+*    Passes the TCCR2 value: TIMER2_CTC_PRESCALER_8 or TIMER2_CTC_PRESCALER_64.
+*  - timer_ticks: uint8_t
+*    Passes the number of ticks, 1 or more.
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+static void one_wire_timer_start(uint8_t timer_control, uint8_t timer_ticks)
+{
+	TCCR2 = TIMER2_STOPPED;
+	TCNT2 = INITIALIZE_TO_ZERO;
+	OCR2 = timer_ticks - 1U;
+	TIFR = (1<<OCF2);  /* Clearing a pending compare match by writing one to its flag */
+	BIT_SET(TIMSK, OCIE2);
+	TCCR2 = timer_control;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  one_wire_reset_start
+*
+** Description:
+*  This function pulls the bus low, and starts the reset low time. It's called with the interrupts disabled.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+static void one_wire_reset_start(void)
+{
+	gpio_pins_direction_set_fast(ONE_WIRE_PORT, ONE_WIRE_PIN_MASK, GPIO_OUTPUT);
+	g_one_wire_phase = ONE_WIRE_PHASE_RESET_RELEASE;
+	one_wire_timer_start(TIMER2_CTC_PRESCALER_64, ONE_WIRE_RESET_TICKS(ONE_WIRE_RESET_LOW_US));
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  one_wire_slots_start
+*
+** Description:
+*  This function starts a sequence of time slots, writing the bits of a byte LSB first. The first slot starts from
+*  the Timer2 interrupt. It's called with the interrupts disabled.
+*
+** Input Parameters:
+*  - data_byte: uint8_t
+*    Passes the bits to write.
+*  - bit_count: uint8_t
+*    Passes the number of bits, from 1 to 8.
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+static void one_wire_slots_start(uint8_t data_byte, uint8_t bit_count)
+{
+	g_one_wire_data = data_byte;
+	g_one_wire_bits_left = bit_count;
+	g_one_wire_phase = ONE_WIRE_PHASE_SLOT_START;
+	one_wire_timer_start(TIMER2_CTC_PRESCALER_8, ONE_WIRE_SLOT_TICKS(ONE_WIRE_FIRST_SLOT_DELAY_US));
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  one_wire_slot_begin
+*
+** Description:
+*  This function starts a time slot for the LSB of g_one_wire_data. It's called by the Timer2 interrupt, and restarts
+*  Timer2 right after pulling the bus low, so the slot timing counts from the falling edge, however late the
+*  interrupt was. A write 1 slot is released after a 2 us busy wait, since that is too short for a compare match of
+*  its own. Then the bus is sampled about 12 us after the falling edge.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+static void one_wire_slot_begin(void)
+{
+	gpio_pins_direction_set_fast(ONE_WIRE_PORT, ONE_WIRE_PIN_MASK, GPIO_OUTPUT);
+	TCNT2 = INITIALIZE_TO_ZERO;
+	TIFR = (1<<OCF2);  /* Clearing a compare match that happened while the interrupt was delayed */
+
+	if (INITIALIZE_TO_ZERO != (g_one_wire_data & 1U))
+	{
+		OCR2 = ONE_WIRE_SAMPLE_TICKS - 1U;
+		g_one_wire_phase = ONE_WIRE_PHASE_SLOT_SAMPLE;
+		_delay_us(ONE_WIRE_SLOT_LOW_US);
+		gpio_pins_direction_set_fast(ONE_WIRE_PORT, ONE_WIRE_PIN_MASK, GPIO_INPUT);
+	}
+	else
+	{
+		OCR2 = ONE_WIRE_SLOT_TICKS(ONE_WIRE_WRITE_0_LOW_US) - 1U;
+		g_one_wire_phase = ONE_WIRE_PHASE_SLOT_RELEASE;
+	}
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  one_wire_reset_complete
+*
+** Description:
+*  This function ends a reset. A reset operation is complete, while a search goes on with the search ROM command if
+*  a device is present.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+static void one_wire_reset_complete(void)
+{
+	if (INITIALIZE_TO_ZERO == g_one_wire_presence)
+	{
+		if (ONE_WIRE_OPERATION_SEARCH == g_one_wire_operation)
+		{
+			one_wire_search_clear();
+		}
+		one_wire_operation_complete(ONE_WIRE_RESULT_NO_PRESENCE);
+	}
+	else if (ONE_WIRE_OPERATION_SEARCH == g_one_wire_operation)
+	{
+		g_one_wire_search_step = ONE_WIRE_SEARCH_COMMAND;
+		one_wire_slots_start(ONE_WIRE_SEARCH_ROM, ONE_WIRE_BYTE_BITS);
+	}
+	else
+	{
+		one_wire_operation_complete(ONE_WIRE_RESULT_DONE);
+	}
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  one_wire_slot_complete
+*
+** Description:
+*  This function is called at the end of each time slot. A byte operation shifts the read bit in, and starts the
+*  next slot right away, or completes once the 8 bits are done.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+static void one_wire_slot_complete(void)
+{
+	if (ONE_WIRE_OPERATION_SEARCH == g_one_wire_operation)
+	{
+		one_wire_search_slot_complete();
+	}
+	else
+	{
+		g_one_wire_data >>= 1;
+		if (INITIALIZE_TO_ZERO != g_one_wire_read_bit)
+		{
+			g_one_wire_data |= ONE_WIRE_DATA_MSB;
+		}
+		g_one_wire_bits_left--;
+
+		if (INITIALIZE_TO_ZERO != g_one_wire_bits_left)
+		{
+			one_wire_slot_begin();
+		}
+		else
+		{
+			g_one_wire_read_data = g_one_wire_data;
+			one_wire_operation_complete(ONE_WIRE_RESULT_DONE);
+		}
+	}
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  one_wire_search_slot_complete
+*
+** Description:
+*  This function runs the search ROM algorithm, one time slot at a time. For each ROM bit, the devices send the bit
+*  and its complement, then the master writes the direction, and only the devices whose bit matches it stay in the
+*  search:
+*  - Bit 1, complement 1: no device is left, the search failed.
+*  - Bit and complement different: all the devices have the same bit.
+*  - Bit 0, complement 0: the devices differ. Below the last discrepancy, the branch of the previous search is taken
+*    again; at it, the one branch; above it, the zero branch, which is remembered as the last zero.
+*  Each ROM byte is added to the CRC-8 once its 8 bits are known.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+static void one_wire_search_slot_complete(void)
+{
+	uint8_t rom_byte_index = g_one_wire_search_bit_number >> 3;
+	uint8_t rom_bit_mask = (uint8_t)(1U << (g_one_wire_search_bit_number & 0x07U));
+	uint8_t bit_position = g_one_wire_search_bit_number + 1U;   /* 1 to 64 */
+	uint8_t direction = INITIALIZE_TO_ZERO;
+
+	switch (g_one_wire_search_step)
+	{
+		case ONE_WIRE_SEARCH_COMMAND:
+		g_one_wire_data >>= 1;
+		g_one_wire_bits_left--;
+		if (INITIALIZE_TO_ZERO != g_one_wire_bits_left)
+		{
+			one_wire_slot_begin();
+		}
+		else
+		{
+			g_one_wire_search_step = ONE_WIRE_SEARCH_ID_BIT;
+			g_one_wire_data = 1U;   /* Read slot */
+			one_wire_slot_begin();
+		}
+		break;
+
+		case ONE_WIRE_SEARCH_ID_BIT:
+		g_one_wire_search_id_bit = g_one_wire_read_bit;
+		g_one_wire_search_step = ONE_WIRE_SEARCH_COMPLEMENT_BIT;
+		g_one_wire_data = 1U;   /* Read slot */
+		one_wire_slot_begin();
+		break;
+
+		case ONE_WIRE_SEARCH_COMPLEMENT_BIT:
+		if ((INITIALIZE_TO_ZERO != g_one_wire_search_id_bit) && (INITIALIZE_TO_ZERO != g_one_wire_read_bit))
+		{
+			one_wire_search_clear();
+			one_wire_operation_complete(ONE_WIRE_RESULT_SEARCH_FAILED);
+		}
+		else
+		{
+			if (g_one_wire_search_id_bit != g_one_wire_read_bit)
+			{
+				direction = g_one_wire_search_id_bit;
+			}
+			else if (bit_position < g_one_wire_last_discrepancy)
+			{
+				direction = (INITIALIZE_TO_ZERO != (g_one_wire_rom[rom_byte_index] & rom_bit_mask)) ? 1U : 0U;
+			}
+			else
+			{
+				direction = (bit_position == g_one_wire_last_discrepancy) ? 1U : 0U;
+			}
+
+			if (INITIALIZE_TO_ZERO != direction)
+			{
+				g_one_wire_rom[rom_byte_index] |= rom_bit_mask;
+			}
+			else
+			{
+				g_one_wire_rom[rom_byte_index] &= (uint8_t)(~rom_bit_mask);
+				if (g_one_wire_search_id_bit == g_one_wire_read_bit)
+				{
+					g_one_wire_search_last_zero = bit_position;
+				}
+			}
+
+			g_one_wire_search_step = ONE_WIRE_SEARCH_DIRECTION_BIT;
+			g_one_wire_data = direction;
+			one_wire_slot_begin();
+		}
+		break;
+
+		case ONE_WIRE_SEARCH_DIRECTION_BIT:
+		g_one_wire_search_bit_number++;
+		if (INITIALIZE_TO_ZERO == (g_one_wire_search_bit_number & 0x07U))
+		{
+			g_one_wire_search_crc = one_wire_crc8_update(g_one_wire_search_crc, g_one_wire_rom[rom_byte_index]);
+		}
+
+		if (ONE_WIRE_ROM_BITS != g_one_wire_search_bit_number)
+		{
+			g_one_wire_search_step = ONE_WIRE_SEARCH_ID_BIT;
+			g_one_wire_data = 1U;   /* Read slot */
+			one_wire_slot_begin();
+		}
+		else if (ONE_WIRE_CRC8_INITIAL_VALUE == g_one_wire_search_crc)
+		{
+			/* The CRC-8 of the 7 bytes and their CRC byte is zero: */
+			g_one_wire_last_discrepancy = g_one_wire_search_last_zero;
+			if (INITIALIZE_TO_ZERO == g_one_wire_last_discrepancy)
+			{
+				g_one_wire_last_device_found = 1U;
+			}
+			g_one_wire_rom_valid = 1U;
+			one_wire_operation_complete(ONE_WIRE_RESULT_DONE);
+		}
+		else
+		{
+			one_wire_search_clear();
+			one_wire_operation_complete(ONE_WIRE_RESULT_SEARCH_FAILED);
+		}
+		break;
+
+		default:
+		one_wire_operation_complete(ONE_WIRE_RESULT_SEARCH_FAILED);
+		break;
+	}
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  one_wire_search_clear
+*
+** Description:
+*  This function clears the state kept from one search to the next, so the next search finds the first device.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+static void one_wire_search_clear(void)
+{
+	g_one_wire_last_discrepancy = INITIALIZE_TO_ZERO;
+	g_one_wire_last_device_found = INITIALIZE_TO_ZERO;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  one_wire_operation_complete
+*
+** Description:
+*  This function stops Timer2, stores the result, and calls the complete callback, which may start the next
+*  operation.
+*
+** Input Parameters:
+*  - result: one_wire_result_t
+*    Passes the result of the operation.
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+static void one_wire_operation_complete(one_wire_result_t result)
+{
+	TCCR2 = TIMER2_STOPPED;
+	BIT_CLEAR(TIMSK, OCIE2);
+	g_one_wire_result = result;
+	g_one_wire_busy = INITIALIZE_TO_ZERO;
+
+	if (NULL != g_one_wire_complete_callback)
+	{
+		g_one_wire_complete_callback();
+	}
+}
+
+/*********************************************************************************************************************
+Interrupt service routine definition for the Timer2 compare match interrupt, which fires at each phase of a reset or
+a time slot. Timer2 restarts from zero at the compare match, so each OCR2 value counts from the previous compare
+match, and the time the interrupt takes doesn't add up. The phases of a time slot count from its falling edge instead,
+since one_wire_slot_begin restarts Timer2. A recovery phase that is started too late for its compare match only
+gets longer, as Timer2 wraps around.
+*********************************************************************************************************************/
+ISR(TIMER2_COMP_vect)
+{
+	switch (g_one_wire_phase)
+	{
+		case ONE_WIRE_PHASE_RESET_RELEASE:
+		gpio_pins_direction_set_fast(ONE_WIRE_PORT, ONE_WIRE_PIN_MASK, GPIO_INPUT);
+		OCR2 = ONE_WIRE_RESET_TICKS(ONE_WIRE_PRESENCE_SAMPLE_US) - 1U;
+		g_one_wire_phase = ONE_WIRE_PHASE_PRESENCE_SAMPLE;
+		break;
+
+		case ONE_WIRE_PHASE_PRESENCE_SAMPLE:
+		/* The devices answer by holding the bus low: */
+		g_one_wire_presence = (GPIO_PIN_LOW == gpio_pin_read_fast(ONE_WIRE_PORT, ONE_WIRE_PIN)) ? 1U : 0U;
+		OCR2 = ONE_WIRE_RESET_TICKS(ONE_WIRE_RESET_RECOVERY_US) - 1U;
+		g_one_wire_phase = ONE_WIRE_PHASE_RESET_END;
+		break;
+
+		case ONE_WIRE_PHASE_RESET_END:
+		one_wire_reset_complete();
+		break;
+
+		case ONE_WIRE_PHASE_SLOT_START:
+		one_wire_slot_begin();
+		break;
+
+		case ONE_WIRE_PHASE_SLOT_RELEASE:
+		gpio_pins_direction_set_fast(ONE_WIRE_PORT, ONE_WIRE_PIN_MASK, GPIO_INPUT);
+		g_one_wire_read_bit = INITIALIZE_TO_ZERO;
+		OCR2 = ONE_WIRE_SLOT_TICKS(ONE_WIRE_WRITE_0_RECOVERY_US) - 1U;
+		g_one_wire_phase = ONE_WIRE_PHASE_SLOT_END;
+		break;
+
+		case ONE_WIRE_PHASE_SLOT_SAMPLE:
+		g_one_wire_read_bit = (GPIO_PIN_HIGH == gpio_pin_read_fast(ONE_WIRE_PORT, ONE_WIRE_PIN)) ? 1U : 0U;
+		OCR2 = ONE_WIRE_SLOT_TICKS(ONE_WIRE_READ_RECOVERY_US) - 1U;
+		g_one_wire_phase = ONE_WIRE_PHASE_SLOT_END;
+		break;
+
+		case ONE_WIRE_PHASE_SLOT_END:
+		one_wire_slot_complete();
+		break;
+
+		default:
+		one_wire_operation_complete(ONE_WIRE_RESULT_DONE);
+		break;
+	}
+}
+
+/*********************************************************************************************************************
+                                                << End of File >>
+*********************************************************************************************************************/
@@ -0,0 +1,347 @@
+/*********************************************************************************************************************
+* Author : Alsayed Alsisi
+* Date   : Thursday, May 06, 2021
+* Version: 1.0
+* Contact: alsayed.alsisi@gmail.com
+* License:
+* You have the right to use the file as you wish in any educational or commercial purposes under the following
+* conditions:
+* [1] This file is to be used as is. No modifications are to be made to any part of the file, including this section.
+* [2] This section is not to be removed under any circumstances.
+* [3] Parts of the file may be used separately under the condition they are not modified, and preceded by this section.
+* [4] Any bug encountered in this file or parts of it should be reported to the email address given above to be fixed.
+* [5] No warranty is expressed or implied by the publication or distribution of this source code.
+*********************************************************************************************************************/
+/*********************************************************************************************************************
+* File Information:
+** File Name:
+*  one_wire_atmega32.h
+*
+** Description:
+*  This file contains the public programming interfaces for a 1-Wire bus master on a GPIO pin of the atmega32
+*  microcontroller, at the standard speed. Each operation (reset, byte write, byte read, ROM search) is started by a
+*  function that returns right away, and is run by the Timer2 compare match interrupt, one time slot phase per
+*  interrupt, so the main loop and the other drivers, like the UART, keep running meanwhile. The end of the operation
+*  is reported by one_wire_is_ready, one_wire_result_get, and the complete callback.
+*  The pin is selected in one_wire_config.h. The driver pulls it low by making it an output, and releases it by making
+*  it an input, so the bus needs an external pull-up resistor. Timer2 belongs to the driver while an operation runs.
+*
+** Timing:
+*  A read slot has to be sampled within 15 us from its falling edge. Timer2 is restarted right after the falling edge,
+*  and the sample compare match is set early by the estimated time the interrupt takes to reach the pin read (about
+*  56 CPU cycles), so the sample is about 12 us after the edge. Another interrupt routine or an ATOMIC_BLOCK that is
+*  running at the sample compare match can delay it by up to about 3 us safely. Longer ones can corrupt a read bit,
+*  which the CRC-8 of the ROM codes and of the scratchpads catches. A delayed start of a slot only delays the whole
+*  slot, and a write 0 slot stays low for at least 60 us. The only busy wait is the 2 us low time of a write 1 or read
+*  slot, inside the interrupt.
+*********************************************************************************************************************/
+
+
+/*********************************************************************************************************************
+                                               << Header Guard >>
+*********************************************************************************************************************/
+#ifndef ONE_WIRE_ATMEGA32_H_
+#define ONE_WIRE_ATMEGA32_H_
+
+/*********************************************************************************************************************
+                                               << File Inclusions >>
+*********************************************************************************************************************/
+#include <stdint.h>
+
+/*********************************************************************************************************************
+                                               << Public Constants >>
+*********************************************************************************************************************/
+/* Number of bytes in a ROM code: family code, 48-bit serial number, CRC-8: */
+#define   ONE_WIRE_ROM_SIZE                 (8U)
+
+/* ROM and function commands: */
+#define   ONE_WIRE_SEARCH_ROM               (0xF0U)
+#define   ONE_WIRE_READ_ROM                 (0x33U)
+#define   ONE_WIRE_MATCH_ROM                (0x55U)
+#define   ONE_WIRE_SKIP_ROM                 (0xCCU)
+
+/* Initial value of the CRC-8 passed to one_wire_crc8_update: */
+#define   ONE_WIRE_CRC8_INITIAL_VALUE       (0x00U)
+
+
+/*********************************************************************************************************************
+                                               << Public Data Types >>
+*********************************************************************************************************************/
+typedef enum
+{
+	ONE_WIRE_E_OK = 0,
+	ONE_WIRE_E_NOT_OK = 1
+	} one_wire_std_error_type_t;
+
+typedef enum
+{
+	ONE_WIRE_NOT_READY = 0,
+	ONE_WIRE_READY = 1
+	} one_wire_is_ready_t;
+
+/* Result of the last operation: */
+typedef enum
+{
+	ONE_WIRE_RESULT_PENDING = 0,     /* Running */
+	ONE_WIRE_RESULT_DONE,            /* Complete. A reset got a presence pulse, a search found a device */
+	ONE_WIRE_RESULT_NO_PRESENCE,     /* No device answered the reset pulse */
+	ONE_WIRE_RESULT_SEARCH_FAILED    /* No device answered a ROM bit, or the ROM code has a wrong CRC-8 */
+	} one_wire_result_t;
+
+/*********************************************************************************************************************
+                                           << Public Function Declarations >>
+*********************************************************************************************************************/
+/*********************************************************************************************************************
+** Function Name:
+*  one_wire_init
+*
+** Description:
+*  This function releases the bus pin, stops Timer2, and clears the search state.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+extern void one_wire_init(void);
+
+/*********************************************************************************************************************
+** Function Name:
+*  one_wire_reset
+*
+** Description:
+*  This function starts a reset pulse, and samples the presence pulse of the devices. The result is
+*  ONE_WIRE_RESULT_DONE if a device is present, and ONE_WIRE_RESULT_NO_PRESENCE otherwise. It takes about 1 ms.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - one_wire_std_error_type_t
+*    The return value returns ONE_WIRE_E_OK if the reset started, and returns "ONE_WIRE_E_NOT_OK" if an operation is
+*    still running.
+*********************************************************************************************************************/
+extern one_wire_std_error_type_t one_wire_reset(void);
+
+/*********************************************************************************************************************
+** Function Name:
+*  one_wire_byte_write
+*
+** Description:
+*  This function starts writing a byte to the bus, LSB first. It takes about 600 us.
+*
+** Input Parameters:
+*  - data_byte: uint8_t
+*    Passes the byte to be written.
+*
+** Return Value:
+*  - one_wire_std_error_type_t
+*    The return value returns ONE_WIRE_E_OK if the write started, and returns "ONE_WIRE_E_NOT_OK" if an operation is
+*    still running.
+*********************************************************************************************************************/
+extern one_wire_std_error_type_t one_wire_byte_write(uint8_t data_byte);
+
+/*********************************************************************************************************************
+** Function Name:
+*  one_wire_byte_read
+*
+** Description:
+*  This function starts reading a byte from the bus. Once it's complete, the byte is returned by one_wire_data_get.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - one_wire_std_error_type_t
+*    The return value returns ONE_WIRE_E_OK if the read started, and returns "ONE_WIRE_E_NOT_OK" if an operation is
+*    still running.
+*********************************************************************************************************************/
+extern one_wire_std_error_type_t one_wire_byte_read(void);
+
+/*********************************************************************************************************************
+** Function Name:
+*  one_wire_data_get
+*
+** Description:
+*  This function returns the byte read by the last one_wire_byte_read.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - uint8_t
+*    Returns the byte read.
+*********************************************************************************************************************/
+extern uint8_t one_wire_data_get(void);
+
+/*********************************************************************************************************************
+** Function Name:
+*  one_wire_search_first
+*
+** Description:
+*  This function clears the search state, and starts searching for the first device on the bus.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - one_wire_std_error_type_t
+*    The return value returns ONE_WIRE_E_OK if the search started, and returns "ONE_WIRE_E_NOT_OK" if an operation is
+*    still running.
+*
+** Use Example:
+*  uint8_t rom[ONE_WIRE_ROM_SIZE];
+*  one_wire_search_first();
+*  ...
+*  // Each time the driver is ready:
+*  if ((ONE_WIRE_RESULT_DONE == one_wire_result_get()) && (ONE_WIRE_E_OK == one_wire_search_rom_get(rom)))
+*  {
+*      // Store rom, then look for the next device:
+*      if (ONE_WIRE_E_NOT_OK == one_wire_search_next()) {...}   // That was the last device
+*  }
+*********************************************************************************************************************/
+extern one_wire_std_error_type_t one_wire_search_first(void);
+
+/*********************************************************************************************************************
+** Function Name:
+*  one_wire_search_next
+*
+** Description:
+*  This function starts searching for the next device on the bus, following the search ROM algorithm: a reset, the
+*  search ROM command, then for each of the 64 ROM bits, a read of the bit, a read of its complement, and a write of
+*  the selected direction. When two devices differ at a bit, the zero branch is taken first, and the one branch by a
+*  later search. The ROM code is checked with its CRC-8 as its bytes are received.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - one_wire_std_error_type_t
+*    The return value returns ONE_WIRE_E_OK if the search started, and returns "ONE_WIRE_E_NOT_OK" if an operation is
+*    still running, or the last device was already found.
+*********************************************************************************************************************/
+extern one_wire_std_error_type_t one_wire_search_next(void);
+
+/*********************************************************************************************************************
+** Function Name:
+*  one_wire_search_rom_get
+*
+** Description:
+*  This function copies the ROM code found by the last search.
+*
+** Input Parameters:
+*  - rom: uint8_t*
+*    Passes an array of ONE_WIRE_ROM_SIZE bytes for the ROM code, family code first.
+*
+** Return Value:
+*  - one_wire_std_error_type_t
+*    The return value returns ONE_WIRE_E_OK if the ROM code is copied, and returns "ONE_WIRE_E_NOT_OK" if the last
+*    search didn't find a device, or is still running.
+*********************************************************************************************************************/
+extern one_wire_std_error_type_t one_wire_search_rom_get(uint8_t* rom);
+
+/*********************************************************************************************************************
+** Function Name:
+*  one_wire_is_ready
+*
+** Description:
+*  This function returns whether the last operation is complete.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - one_wire_is_ready_t
+*    Returns "ONE_WIRE_READY" if no operation is running, and "ONE_WIRE_NOT_READY" otherwise.
+*********************************************************************************************************************/
+extern one_wire_is_ready_t one_wire_is_ready(void);
+
+/*********************************************************************************************************************
+** Function Name:
+*  one_wire_result_get
+*
+** Description:
+*  This function returns the result of the last operation.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - one_wire_result_t
+*    Returns ONE_WIRE_RESULT_PENDING while it's running, then its result.
+*********************************************************************************************************************/
+extern one_wire_result_t one_wire_result_get(void);
+
+/*********************************************************************************************************************
+** Function Name:
+*  one_wire_complete_callback_set
+*
+** Description:
+*  This function sets the callback that is called from the Timer2 interrupt once an operation is complete. The
+*  callback can start the next operation, to chain the steps of a command without the main loop.
+*
+** Input Parameters:
+*  - complete_callback: void (*)(void)
+*    Passes the address of the callback function, or NULL.
+*
+** Return Value:
+*  - void
+*
+** Use Example:
+*  Starting the temperature conversion of all the DS18B20 probes, while the main loop keeps serving the UART:
+*  static uint8_t convert_step = 0;
+*  void convert_step_run(void)
+*  {
+*      convert_step++;
+*      if ((1 == convert_step) && (ONE_WIRE_RESULT_DONE == one_wire_result_get()))
+*      {
+*          one_wire_byte_write(ONE_WIRE_SKIP_ROM);
+*      }
+*      else if (2 == convert_step)
+*      {
+*          one_wire_byte_write(0x44);   // Convert T, which takes up to 750 ms
+*      }
+*  }
+*  ...
+*  one_wire_complete_callback_set(convert_step_run);
+*  convert_step = 0;
+*  one_wire_reset();
+*********************************************************************************************************************/
+extern void one_wire_complete_callback_set(void (*complete_callback)(void));
+
+/*********************************************************************************************************************
+** Function Name:
+*  one_wire_crc8_update
+*
+** Description:
+*  This function adds a byte to a running 1-Wire CRC-8 (polynomial x^8 + x^5 + x^4 + 1), so the CRC of a ROM code
+*  or of a scratchpad can be calculated while its bytes are read. Once the CRC byte itself is added, the result is
+*  zero if the data is correct.
+*
+** Input Parameters:
+*  - crc: uint8_t
+*    Passes the CRC so far, starting with ONE_WIRE_CRC8_INITIAL_VALUE.
+*  - data_byte: uint8_t
+*    Passes the next byte.
+*
+** Return Value:
+*  - uint8_t
+*    Returns the updated CRC.
+*
+** Use Example:
+*  crc = ONE_WIRE_CRC8_INITIAL_VALUE;
+*  ...
+*  // After each one_wire_byte_read is complete:
+*  crc = one_wire_crc8_update(crc, one_wire_data_get());
+*  ...
+*  if (0 == crc) {...}   // All 9 scratchpad bytes, including the CRC byte, are correct
+*********************************************************************************************************************/
+extern uint8_t one_wire_crc8_update(uint8_t crc, uint8_t data_byte);
+
+
+
+#endif /* ONE_WIRE_ATMEGA32_H_ */
+/*********************************************************************************************************************
+                                               << End of File >>
+*********************************************************************************************************************/
@@ -0,0 +1,55 @@
+/*********************************************************************************************************************
+* Author : Alsayed Alsisi
+* Date   : Thursday, May 06, 2021
+* Version: 1.0
+* Contact: alsayed.alsisi@gmail.com
+* License:
+* You have the right to use the file as you wish in any educational or commercial purposes under the following
+* conditions:
+* [1] This file is to be used as is. No modifications are to be made to any part of the file, including this section.
+* [2] This section is not to be removed under any circumstances.
+* [3] Parts of the file may be used separately under the condition they are not modified, and preceded by this section.
+* [4] Any bug encountered in this file or parts of it should be reported to the email address given above to be fixed.
+* [5] No warranty is expressed or implied by the publication or distribution of this source code.
+*********************************************************************************************************************/
+/*********************************************************************************************************************
+* File Information:
+** File Name:
+*  one_wire_config.h
+*
+** Description:
+*  This file contains the set of configurations for the 1-Wire bus master driver of the atmega32 microcontroller.
+*********************************************************************************************************************/
+
+
+#ifndef ONE_WIRE_CONFIG_H_
+#define ONE_WIRE_CONFIG_H_
+
+
+/*
+Define the CPU clock frequency. This is important to calculate the Timer2 ticks of the 1-Wire time slots.
+It needs to be from 12 MHz to 20 MHz. Below 12 MHz, the two interrupts of a read slot take too long to sample the
+bus within 15 us from the start of the slot.
+*/
+#define F_CPU  12000000UL
+
+
+/* Choosing the port of the 1-Wire bus pin
+** Options:
+* GPIO_PORTA
+* GPIO_PORTB
+* GPIO_PORTC
+* GPIO_PORTD
+*/
+#define ONE_WIRE_PORT  GPIO_PORTC
+
+/* Choosing the 1-Wire bus pin
+** Options:
+* GPIO_PIN0 to GPIO_PIN7
+* Note: The bus needs an external pull-up resistor, usually 4.7 kOhm, since the driver only pulls the pin low or
+*       releases it.
+*/
+#define ONE_WIRE_PIN   GPIO_PIN7
+
+
+#endif /* ONE_WIRE_CONFIG_H_ */
@@ -0,0 +1,691 @@
+/*********************************************************************************************************************
+* Author : Alsayed Alsisi
+* Date   : Thursday, May 06, 2021
+* Version: 1.0
+* Contact: alsayed.alsisi@gmail.com
+* License:
+* You have the right to use the file as you wish in any educational or commercial purposes under the following
+* conditions:
+* [1] This file is to be used as is. No modifications are to be made to any part of the file, including this section.
+* [2] This section is not to be removed under any circumstances.
+* [3] Parts of the file may be used separately under the condition they are not modified, and preceded by this section.
+* [4] Any bug encountered in this file or parts of it should be reported to the email address given above to be fixed.
+* [5] No warranty is expressed or implied by the publication or distribution of this source code.
+*********************************************************************************************************************/
+/*********************************************************************************************************************
+* File Information:
+** File Name:
+*  spi_atmega32.c
+*
+** Description:
+*  This file contains the implementation for the device driver of SPI peripheral of the atmega32 microcontroller.
+*********************************************************************************************************************/
+
+
+/*********************************************************************************************************************
+                                               << File Inclusions >>
+*********************************************************************************************************************/
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <util/atomic.h>
+#include <stdint.h>
+#include <stddef.h>
+#include "spi_atmega32.h"
+#include "gpio_atmega32.h"
+#include "bit_math.h"
+
+/*********************************************************************************************************************
+                                              << Private Constants >>
+*********************************************************************************************************************/
+#define   INITIALIZE_TO_ZERO      (0U)
+
+/* SPI pins on PORTB: */
+#define   SPI_SS_PIN              GPIO_PIN4
+#define   SPI_MOSI_PIN            GPIO_PIN5
+#define   SPI_MISO_PIN            GPIO_PIN6
+#define   SPI_SCK_PIN             GPIO_PIN7
+
+#define   SPI_MODE_LAST           SPI_MODE_3
+#define   SPI_CLOCK_DIV_LAST      SPI_CLOCK_DIV_32
+#define   SPI_SPR_BITS_MASK       (0x03U)   /* SPR1:0 bits of spi_clock_divider_t */
+#define   SPI_SPI2X_SHIFT         (2U)      /* SPI2X bit of spi_clock_divider_t */
+
+/* One entry more than the queue size, so that a full queue can be told from an empty one: */
+#define   SPI_QUEUE_ENTRIES       (SPI_QUEUE_SIZE + 1U)
+
+/*********************************************************************************************************************
+                                              << Private Data Types >>
+*********************************************************************************************************************/
+
+
+/*********************************************************************************************************************
+                                          << Private Variable Definitions >>
+*********************************************************************************************************************/
+/* Master transaction queue. The transactions are owned by the application, the queue only holds their addresses: */
+static spi_transaction_t* g_spi_queue[SPI_QUEUE_ENTRIES];
+static volatile uint8_t g_spi_queue_head = INITIALIZE_TO_ZERO;   /* Next free entry */
+static volatile uint8_t g_spi_queue_tail = INITIALIZE_TO_ZERO;   /* Next transaction to start */
+
+/* Set while a queued transaction or a polled transfer is using the bus: */
+static volatile uint8_t g_spi_bus_busy = INITIALIZE_TO_ZERO;
+
+/* Transaction in progress: */
+static spi_transaction_t* g_spi_current = NULL;
+static uint16_t g_spi_current_index = INITIALIZE_TO_ZERO;
+
+/* Slave operation: */
+static uint8_t g_spi_slave_enabled = INITIALIZE_TO_ZERO;
+static uint8_t* g_spi_slave_rx_buffer = NULL;
+static uint8_t g_spi_slave_rx_buffer_size = INITIALIZE_TO_ZERO;
+static volatile uint8_t g_spi_slave_rx_buffer_head = INITIALIZE_TO_ZERO;   /* Written only by the interrupt routine */
+static volatile uint8_t g_spi_slave_rx_buffer_tail = INITIALIZE_TO_ZERO;   /* Written only by spi_slave_rx_buffer_read */
+static const uint8_t* g_spi_slave_response = NULL;
+static uint8_t g_spi_slave_response_length = INITIALIZE_TO_ZERO;
+static uint8_t g_spi_slave_response_index = INITIALIZE_TO_ZERO;
+/* Prepared by the interrupt for the following byte, so that it's written to SPDR without any delay: */
+static uint8_t g_spi_slave_next_byte = SPI_DUMMY_BYTE;
+
+/*********************************************************************************************************************
+                                          << Public Variable Definitions >>
+*********************************************************************************************************************/
+
+
+/*********************************************************************************************************************
+                                         << Private Functions Prototypes >>
+*********************************************************************************************************************/
+static void spi_transaction_start(void);
+static inline void spi_master_byte_exchange(void);
+static inline void spi_slave_byte_exchange(void);
+
+/*********************************************************************************************************************
+                                          << Public Function Definitions >>
+*********************************************************************************************************************/
+/*********************************************************************************************************************
+** Function Name:
+*  spi_master_init
+*
+** Description:
+*  This function enables the SPI peripheral in master operation.
+*
+** Input Parameters:
+*  - spi_mode: spi_mode_t
+*    This parameter selects the clock polarity and phase.
+*  - spi_clock_divider: spi_clock_divider_t
+*    This parameter selects the SCK frequency.
+*  - spi_data_order: spi_data_order_t
+*    This parameter selects which bit of each byte is sent first.
+*
+** Return Value:
+*  - spi_std_error_type_t
+*    The return value returns SPI_E_OK if all the passed configurations are correct, and returns "SPI_E_NOT_OK"
+*    otherwise.
+*********************************************************************************************************************/
+spi_std_error_type_t spi_master_init(spi_mode_t spi_mode, spi_clock_divider_t spi_clock_divider,
+                                     spi_data_order_t spi_data_order)
+{
+	spi_std_error_type_t return_error = SPI_E_NOT_OK;
+
+	if ((SPI_MODE_LAST >= spi_mode) && (SPI_CLOCK_DIV_LAST >= spi_clock_divider) && (SPI_LSB_FIRST >= spi_data_order))
+	{
+		/* SS is driven high, so it doesn't select a slave until it's used as a chip select: */
+		(void)gpio_pins_config(GPIO_PORTB, ((1<<SPI_SS_PIN)|(1<<SPI_MOSI_PIN)|(1<<SPI_SCK_PIN)), GPIO_OUTPUT,
+		                       (1<<SPI_SS_PIN));
+		(void)gpio_pin_config(GPIO_PORTB, SPI_MISO_PIN, GPIO_INPUT, GPIO_PIN_LOW);
+
+		SPCR = (1<<SPE) | (1<<MSTR) | ((uint8_t)spi_data_order << DORD) | ((uint8_t)spi_mode << CPHA) |
+		       ((uint8_t)spi_clock_divider & SPI_SPR_BITS_MASK);
+		SPSR = (uint8_t)((uint8_t)spi_clock_divider >> SPI_SPI2X_SHIFT) << SPI2X;
+		g_spi_slave_enabled = INITIALIZE_TO_ZERO;
+		return_error = SPI_E_OK;
+	}
+	else
+	{
+		return_error = SPI_E_NOT_OK;
+	}
+
+	return return_error;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  spi_chip_select_init
+*
+** Description:
+*  This function configures the chip select pin of a slave as output, at the high level.
+*
+** Input Parameters:
+*  - cs_port: gpio_port_t
+*    This parameter passes the port of the chip select pin.
+*  - cs_pin: gpio_pin_t
+*    This parameter passes the chip select pin.
+*
+** Return Value:
+*  - spi_std_error_type_t
+*    The return value returns SPI_E_OK if the pin is correct, and returns "SPI_E_NOT_OK" otherwise.
+*********************************************************************************************************************/
+spi_std_error_type_t spi_chip_select_init(gpio_port_t cs_port, gpio_pin_t cs_pin)
+{
+	spi_std_error_type_t return_error = SPI_E_NOT_OK;
+
+	if (GPIO_E_OK == gpio_pin_config(cs_port, cs_pin, GPIO_OUTPUT, GPIO_PIN_HIGH))
+	{
+		return_error = SPI_E_OK;
+	}
+	else
+	{
+		return_error = SPI_E_NOT_OK;
+	}
+
+	return return_error;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  spi_transaction_submit
+*
+** Description:
+*  This function adds a transaction to the master queue, and starts it if the bus is free.
+*
+** Input Parameters:
+*  - spi_transaction: spi_transaction_t*
+*    Passes the address of the transaction.
+*
+** Return Value:
+*  - spi_std_error_type_t
+*    The return value returns SPI_E_OK if the transaction is queued, and returns "SPI_E_NOT_OK" otherwise.
+*********************************************************************************************************************/
+spi_std_error_type_t spi_transaction_submit(spi_transaction_t* spi_transaction)
+{
+	spi_std_error_type_t return_error = SPI_E_NOT_OK;
+	uint8_t next_head = INITIALIZE_TO_ZERO;
+
+	if ((NULL != spi_transaction) && (INITIALIZE_TO_ZERO != spi_transaction->length) && 
+	    (INITIALIZE_TO_ZERO == g_spi_slave_enabled))
+	{
+		/* The queue is also changed by the SPI interrupt, and by other interrupts that submit transactions: */
+		ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+		{
+			next_head = g_spi_queue_head + 1U;
+			if (SPI_QUEUE_ENTRIES == next_head)
+			{
+				next_head = INITIALIZE_TO_ZERO;
+			}
+
+			if (next_head != g_spi_queue_tail)
+			{
+				g_spi_queue[g_spi_queue_head] = spi_transaction;
+				g_spi_queue_head = next_head;
+				if (INITIALIZE_TO_ZERO == g_spi_bus_busy)
+				{
+					spi_transaction_start();
+				}
+				return_error = SPI_E_OK;
+			}
+			else
+			{
+				return_error = SPI_E_NOT_OK;  /* Queue full */
+			}
+		}
+	}
+	else
+	{
+		return_error = SPI_E_NOT_OK;
+	}
+
+	return return_error;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  spi_is_ready
+*
+** Description:
+*  This function returns whether all the queued transactions are complete.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - spi_is_ready_t
+*    Returns "SPI_READY" if the master queue is empty and the bus is free, and "SPI_NOT_READY" otherwise.
+*********************************************************************************************************************/
+spi_is_ready_t spi_is_ready(void)
+{
+	spi_is_ready_t is_ready = SPI_NOT_READY;
+
+	/* The bus stays busy until the last transaction of the queue is complete: */
+	if (INITIALIZE_TO_ZERO == g_spi_bus_busy)
+	{
+		is_ready = SPI_READY;
+	}
+
+	return is_ready;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  spi_transfer_polled
+*
+** Description:
+*  This function exchanges bytes with a slave by polling the SPI interrupt flag, then starts the transactions that
+*  were queued in the meantime.
+*
+** Input Parameters:
+*  - cs_port: gpio_port_t
+*    Passes the port of the chip select pin.
+*  - cs_pin: gpio_pin_t
+*    Passes the chip select pin.
+*  - tx_data: const uint8_t*
+*    Passes the bytes to transmit, or NULL to transmit SPI_DUMMY_BYTE.
+*  - rx_data: uint8_t*
+*    Passes the array to store the received bytes in, or NULL to ignore them.
+*  - length: uint16_t
+*    Passes the number of bytes to exchange.
+*
+** Return Value:
+*  - spi_std_error_type_t
+*    The return value returns SPI_E_OK if the bytes are exchanged, and returns "SPI_E_NOT_OK" if the bus is busy.
+*********************************************************************************************************************/
+spi_std_error_type_t spi_transfer_polled(gpio_port_t cs_port, gpio_pin_t cs_pin, const uint8_t* tx_data,
+                                         uint8_t* rx_data, uint16_t length)
+{
+	spi_std_error_type_t return_error = SPI_E_NOT_OK;
+	uint16_t i = INITIALIZE_TO_ZERO;
+	uint8_t data_byte = SPI_DUMMY_BYTE;
+
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		if ((INITIALIZE_TO_ZERO == g_spi_bus_busy) && (INITIALIZE_TO_ZERO == g_spi_slave_enabled))
+		{
+			g_spi_bus_busy = 1U;
+			return_error = SPI_E_OK;
+		}
+	}
+
+	if (SPI_E_OK == return_error)
+	{
+		gpio_pin_write_fast(cs_port, cs_pin, GPIO_PIN_LOW);
+		for (i = 0; i < length; i++)
+		{
+			if (NULL != tx_data)
+			{
+				data_byte = tx_data[i];
+			}
+			SPDR = data_byte;
+			while (0 == BIT_GET(SPSR, SPIF))
+			{
+			}
+			data_byte = SPDR;
+			if (NULL != rx_data)
+			{
+				rx_data[i] = data_byte;
+			}
+			data_byte = SPI_DUMMY_BYTE;
+		}
+		gpio_pin_write_fast(cs_port, cs_pin, GPIO_PIN_HIGH);
+
+		ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+		{
+			if (g_spi_queue_head != g_spi_queue_tail)
+			{
+				spi_transaction_start();
+			}
+			else
+			{
+				g_spi_bus_busy = INITIALIZE_TO_ZERO;
+			}
+		}
+	}
+
+	return return_error;
+}
+
+
+/*********************************************************************************************************************
+** Function Name:
+*  spi_slave_init
+*
+** Description:
+*  This function enables the SPI peripheral and its interrupt in slave operation, with an empty response.
+*
+** Input Parameters:
+*  - spi_mode: spi_mode_t
+*    This parameter selects the clock polarity and phase used by the master.
+*  - spi_data_order: spi_data_order_t
+*    This parameter selects which bit of each byte is sent first.
+*  - rx_buffer: uint8_t*
+*    Passes the array to be used as the receive ring buffer.
+*  - rx_buffer_size: uint8_t
+*    Passes the size of the array.
+*
+** Return Value:
+*  - spi_std_error_type_t
+*    The return value returns SPI_E_OK if all the passed configurations are correct, and returns "SPI_E_NOT_OK"
+*    otherwise.
+*********************************************************************************************************************/
+spi_std_error_type_t spi_slave_init(spi_mode_t spi_mode, spi_data_order_t spi_data_order, uint8_t* rx_buffer,
+                                    uint8_t rx_buffer_size)
+{
+	spi_std_error_type_t return_error = SPI_E_NOT_OK;
+
+	if ((SPI_MODE_LAST >= spi_mode) && (SPI_LSB_FIRST >= spi_data_order) && (NULL != rx_buffer) && 
+	    (2U <= rx_buffer_size))
+	{
+		ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+		{
+			g_spi_slave_rx_buffer = rx_buffer;
+			g_spi_slave_rx_buffer_size = rx_buffer_size;
+			g_spi_slave_rx_buffer_head = INITIALIZE_TO_ZERO;
+			g_spi_slave_rx_buffer_tail = INITIALIZE_TO_ZERO;
+			g_spi_slave_response = NULL;
+			g_spi_slave_response_length = INITIALIZE_TO_ZERO;
+			g_spi_slave_response_index = INITIALIZE_TO_ZERO;
+			g_spi_slave_next_byte = SPI_DUMMY_BYTE;
+			g_spi_slave_enabled = 1U;
+
+			(void)gpio_pins_config(GPIO_PORTB, ((1<<SPI_SS_PIN)|(1<<SPI_MOSI_PIN)|(1<<SPI_SCK_PIN)), GPIO_INPUT, 0x00);
+			(void)gpio_pin_config(GPIO_PORTB, SPI_MISO_PIN, GPIO_OUTPUT, GPIO_PIN_HIGH);
+
+			SPCR = (1<<SPE) | (1<<SPIE) | ((uint8_t)spi_data_order << DORD) | ((uint8_t)spi_mode << CPHA);
+			SPDR = SPI_DUMMY_BYTE;
+		}
+		return_error = SPI_E_OK;
+	}
+	else
+	{
+		return_error = SPI_E_NOT_OK;
+	}
+
+	return return_error;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  spi_slave_response_set
+*
+** Description:
+*  This function passes the bytes to be transmitted to the master in slave operation. The first byte is written to
+*  SPDR right away if the slave isn't selected, otherwise it's prepared for the following byte.
+*
+** Input Parameters:
+*  - response: const uint8_t*
+*    Passes the bytes to transmit.
+*  - response_length: uint8_t
+*    Passes the number of bytes to transmit.
+*
+** Return Value:
+*  - spi_std_error_type_t
+*    The return value returns SPI_E_OK if the response is set, and returns "SPI_E_NOT_OK" otherwise.
+*********************************************************************************************************************/
+spi_std_error_type_t spi_slave_response_set(const uint8_t* response, uint8_t response_length)
+{
+	spi_std_error_type_t return_error = SPI_E_NOT_OK;
+
+	if ((INITIALIZE_TO_ZERO != g_spi_slave_enabled) && (NULL != response) && (INITIALIZE_TO_ZERO != response_length))
+	{
+		ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+		{
+			g_spi_slave_response = response;
+			g_spi_slave_response_length = response_length;
+			g_spi_slave_response_index = INITIALIZE_TO_ZERO;
+			/* Writing SPDR while a byte is being shifted would be a write collision, so it's only done while the
+			   master doesn't select the slave: */
+			if (GPIO_PIN_HIGH == gpio_pin_read_fast(GPIO_PORTB, SPI_SS_PIN))
+			{
+				SPDR = response[0];
+				g_spi_slave_response_index = 1U;
+			}
+			if (g_spi_slave_response_length > g_spi_slave_response_index)
+			{
+				g_spi_slave_next_byte = response[g_spi_slave_response_index];
+				g_spi_slave_response_index++;
+			}
+			else
+			{
+				g_spi_slave_next_byte = SPI_DUMMY_BYTE;
+			}
+		}
+		return_error = SPI_E_OK;
+	}
+	else
+	{
+		return_error = SPI_E_NOT_OK;
+	}
+
+	return return_error;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  spi_slave_rx_buffer_read
+*
+** Description:
+*  This function reads the oldest byte from the slave receive ring buffer.
+*
+** Input Parameters:
+*  - data_byte: uint8_t*
+*    This a pointer to read back the received byte in the caller function.
+*
+** Return Value:
+*  - spi_std_error_type_t
+*    The return value returns SPI_E_OK if a byte was read, and returns "SPI_E_NOT_OK" if the buffer is empty.
+*********************************************************************************************************************/
+spi_std_error_type_t spi_slave_rx_buffer_read(uint8_t* data_byte)
+{
+	spi_std_error_type_t return_error = SPI_E_NOT_OK;
+	uint8_t tail = g_spi_slave_rx_buffer_tail;
+
+	/* Checking if the buffer is not empty: */
+	if (tail != g_spi_slave_rx_buffer_head)
+	{
+		*data_byte = g_spi_slave_rx_buffer[tail];
+		tail++;
+		if (g_spi_slave_rx_buffer_size == tail)
+		{
+			tail = INITIALIZE_TO_ZERO;
+		}
+		/* A single byte store, so the interrupt always sees either the old or the new tail: */
+		g_spi_slave_rx_buffer_tail = tail;
+		return_error = SPI_E_OK;
+	}
+
+	return return_error;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  spi_slave_rx_buffer_count
+*
+** Description:
+*  This function returns the number of received bytes waiting in the slave receive ring buffer.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - uint8_t
+*    Returns the number of bytes that can be read from the receive ring buffer.
+*********************************************************************************************************************/
+uint8_t spi_slave_rx_buffer_count(void)
+{
+	uint8_t head = g_spi_slave_rx_buffer_head;
+	uint8_t tail = g_spi_slave_rx_buffer_tail;
+	uint8_t return_value = INITIALIZE_TO_ZERO;
+
+	if (head >= tail)
+	{
+		return_value = head - tail;
+	}
+	else
+	{
+		return_value = (g_spi_slave_rx_buffer_size - tail) + head;
+	}
+
+	return return_value;
+}
+
+
+/*********************************************************************************************************************
+                                          << Private Function Definitions >>
+*********************************************************************************************************************/
+/*********************************************************************************************************************
+** Function Name:
+*  spi_transaction_start
+*
+** Description:
+*  This function takes the next transaction out of the master queue, selects its slave, and transmits its first byte.
+*  The rest of the bytes are exchanged by the SPI interrupt. It's called with the interrupts disabled, and only when
+*  the queue isn't empty.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+static void spi_transaction_start(void)
+{
+	g_spi_current = g_spi_queue[g_spi_queue_tail];
+	g_spi_queue_tail++;
+	if (SPI_QUEUE_ENTRIES == g_spi_queue_tail)
+	{
+		g_spi_queue_tail = INITIALIZE_TO_ZERO;
+	}
+	g_spi_current_index = INITIALIZE_TO_ZERO;
+	g_spi_bus_busy = 1U;
+
+	gpio_pin_write_fast(g_spi_current->cs_port, g_spi_current->cs_pin, GPIO_PIN_LOW);
+	BIT_SET(SPCR, SPIE);
+	if (NULL != g_spi_current->tx_data)
+	{
+		SPDR = g_spi_current->tx_data[0];
+	}
+	else
+	{
+		SPDR = SPI_DUMMY_BYTE;
+	}
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  spi_master_byte_exchange
+*
+** Description:
+*  This function is called by the SPI interrupt in master operation. It stores the received byte and transmits the
+*  next one. At the end of a transaction, it releases the chip select and starts the next transaction before calling
+*  the complete callback, so the bus isn't left idle while the callback runs.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+static inline void spi_master_byte_exchange(void)
+{
+	spi_transaction_t* transaction = g_spi_current;
+	uint8_t data_byte = SPDR;
+
+	if (NULL != transaction->rx_data)
+	{
+		transaction->rx_data[g_spi_current_index] = data_byte;
+	}
+	g_spi_current_index++;
+
+	if (transaction->length != g_spi_current_index)
+	{
+		if (NULL != transaction->tx_data)
+		{
+			SPDR = transaction->tx_data[g_spi_current_index];
+		}
+		else
+		{
+			SPDR = SPI_DUMMY_BYTE;
+		}
+	}
+	else
+	{
+		gpio_pin_write_fast(transaction->cs_port, transaction->cs_pin, GPIO_PIN_HIGH);
+		if (g_spi_queue_head != g_spi_queue_tail)
+		{
+			spi_transaction_start();
+		}
+		else
+		{
+			BIT_CLEAR(SPCR, SPIE);
+			g_spi_current = NULL;
+			g_spi_bus_busy = INITIALIZE_TO_ZERO;
+		}
+
+		if (NULL != transaction->complete_callback)
+		{
+			transaction->complete_callback();
+		}
+	}
+}
+
+
+/*********************************************************************************************************************
+** Function Name:
+*  spi_slave_byte_exchange
+*
+** Description:
+*  This function is called by the SPI interrupt in slave operation. The prepared byte is written to SPDR first, since
+*  the master can start the following byte at any time. Reading SPDR afterwards still returns the received byte, since
+*  the receive direction is buffered. Then the received byte is stored, and the byte after it is prepared.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+static inline void spi_slave_byte_exchange(void)
+{
+	uint8_t next_head = INITIALIZE_TO_ZERO;
+	uint8_t data_byte = INITIALIZE_TO_ZERO;
+
+	SPDR = g_spi_slave_next_byte;
+	data_byte = SPDR;
+
+	next_head = g_spi_slave_rx_buffer_head + 1U;
+	if (g_spi_slave_rx_buffer_size == next_head)
+	{
+		next_head = INITIALIZE_TO_ZERO;
+	}
+	/* Storing the byte if the buffer isn't full, otherwise the byte is dropped: */
+	if (next_head != g_spi_slave_rx_buffer_tail)
+	{
+		g_spi_slave_rx_buffer[g_spi_slave_rx_buffer_head] = data_byte;
+		g_spi_slave_rx_buffer_head = next_head;
+	}
+
+	if (g_spi_slave_response_length > g_spi_slave_response_index)
+	{
+		g_spi_slave_next_byte = g_spi_slave_response[g_spi_slave_response_index];
+		g_spi_slave_response_index++;
+	}
+	else
+	{
+		g_spi_slave_next_byte = SPI_DUMMY_BYTE;
+	}
+}
+
+/*********************************************************************************************************************
+Interrupt service routine definition for the SPI serial transfer complete interrupt.
+*********************************************************************************************************************/
+ISR(SPI_STC_vect)
+{
+	if (INITIALIZE_TO_ZERO != g_spi_slave_enabled)
+	{
+		spi_slave_byte_exchange();
+	}
+	else
+	{
+		spi_master_byte_exchange();
+	}
+}
+
+/*********************************************************************************************************************
+                                                << End of File >>
+*********************************************************************************************************************/
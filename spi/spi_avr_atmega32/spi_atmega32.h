@@ -0,0 +1,355 @@
+/*********************************************************************************************************************
+* Author : Alsayed Alsisi
+* Date   : Thursday, May 06, 2021
+* Version: 1.0
+* Contact: alsayed.alsisi@gmail.com
+* License:
+* You have the right to use the file as you wish in any educational or commercial purposes under the following
+* conditions:
+* [1] This file is to be used as is. No modifications are to be made to any part of the file, including this section.
+* [2] This section is not to be removed under any circumstances.
+* [3] Parts of the file may be used separately under the condition they are not modified, and preceded by this section.
+* [4] Any bug encountered in this file or parts of it should be reported to the email address given above to be fixed.
+* [5] No warranty is expressed or implied by the publication or distribution of this source code.
+*********************************************************************************************************************/
+/*********************************************************************************************************************
+* File Information:
+** File Name:
+*  spi_atmega32.h
+*
+** Description:
+*  This file contains the public programming interfaces for the device driver of SPI peripheral of the atmega32
+*  microcontroller. In master operation, transfers are queued as transactions and run by the SPI interrupt, one byte
+*  per interrupt, with the chip select of each slave driven through the gpio driver. Short transfers can also be done
+*  by polling, which is faster than the interrupt at the highest SPI clocks. In slave operation, the bytes received
+*  from the master are stored in a ring buffer, and the bytes of a prepared response buffer are transmitted back.
+*  The SPI pins are SS = PB4, MOSI = PB5, MISO = PB6, and SCK = PB7.
+*********************************************************************************************************************/
+
+
+/*********************************************************************************************************************
+                                               << Header Guard >>
+*********************************************************************************************************************/
+#ifndef SPI_ATMEGA32_H_
+#define SPI_ATMEGA32_H_
+
+/*********************************************************************************************************************
+                                               << File Inclusions >>
+*********************************************************************************************************************/
+#include <stdint.h>
+#include "gpio_atmega32.h"
+
+/*********************************************************************************************************************
+                                               << Public Constants >>
+*********************************************************************************************************************/
+/* Maximum number of transactions waiting in the master queue, not including the one in progress: */
+#define   SPI_QUEUE_SIZE                    (8U)
+
+/* Byte transmitted by the master when a transaction has no transmit data, and by the slave when it has no response
+   bytes left: */
+#define   SPI_DUMMY_BYTE                    (0xFFU)
+
+
+/*********************************************************************************************************************
+                                               << Public Data Types >>
+*********************************************************************************************************************/
+typedef enum
+{
+	SPI_E_OK = 0,
+	SPI_E_NOT_OK = 1
+	} spi_std_error_type_t;
+
+typedef enum
+{
+	SPI_NOT_READY = 0,
+	SPI_READY = 1
+	} spi_is_ready_t;
+
+/* Clock polarity and phase, as (CPOL, CPHA): */
+typedef enum
+{
+	SPI_MODE_0 = 0,   /* SCK idles low, data sampled on the rising edge */
+	SPI_MODE_1,       /* SCK idles low, data sampled on the falling edge */
+	SPI_MODE_2,       /* SCK idles high, data sampled on the falling edge */
+	SPI_MODE_3        /* SCK idles high, data sampled on the rising edge */
+	} spi_mode_t;
+
+typedef enum
+{
+	SPI_MSB_FIRST = 0,
+	SPI_LSB_FIRST
+	} spi_data_order_t;
+
+/* SCK frequency as a division of the CPU clock. The values are the (SPI2X, SPR1, SPR0) bits: */
+typedef enum
+{
+	SPI_CLOCK_DIV_4   = 0x00,
+	SPI_CLOCK_DIV_16  = 0x01,
+	SPI_CLOCK_DIV_64  = 0x02,
+	SPI_CLOCK_DIV_128 = 0x03,
+	SPI_CLOCK_DIV_2   = 0x04,
+	SPI_CLOCK_DIV_8   = 0x05,
+	SPI_CLOCK_DIV_32  = 0x06
+	} spi_clock_divider_t;
+
+/*********************************************************************************************************************
+** Datatype Name:
+*  spi_transaction_t
+*
+** Description:
+*  This is a structure datatype that describes one transfer with a slave in master operation: the chip select is
+*  driven low, length bytes are exchanged, then the chip select is driven high. The driver keeps a pointer to the
+*  structure, so it and its buffers need to stay unchanged until the transaction is complete.
+*
+** Datatype Elements:
+*  [1] cs_port: gpio_port_t
+*      The port of the chip select pin of the slave.
+*  [2] cs_pin: gpio_pin_t
+*      The chip select pin of the slave, which needs to be configured using spi_chip_select_init.
+*  [3] tx_data: const uint8_t*
+*      The bytes to transmit, or NULL to transmit SPI_DUMMY_BYTE, for example while reading from the slave.
+*  [4] rx_data: uint8_t*
+*      The array to store the received bytes in, or NULL to ignore them, for example while writing to the slave. It
+*      can be the same array as tx_data.
+*  [5] length: uint16_t
+*      The number of bytes to exchange.
+*  [6] complete_callback: void (*)(void)
+*      The function to be called from the SPI interrupt once the transaction is complete, or NULL.
+*
+** Use Example:
+*  [1] Send a 2-byte command to a slave on PB3, then read its 4-byte reply. Both are done in one transaction, so the
+*      chip select stays low in between:
+*      static uint8_t buffer[6] = {0x03, 0x10};
+*      static spi_transaction_t read = {GPIO_PORTB, GPIO_PIN3, buffer, buffer, 6, read_complete};
+*      spi_transaction_submit(&read);
+*********************************************************************************************************************/
+typedef struct
+{
+	gpio_port_t cs_port;
+	gpio_pin_t cs_pin;
+	const uint8_t* tx_data;
+	uint8_t* rx_data;
+	uint16_t length;
+	void (*complete_callback)(void);
+} spi_transaction_t;
+
+/*********************************************************************************************************************
+                                           << Public Function Declarations >>
+*********************************************************************************************************************/
+/*********************************************************************************************************************
+** Function Name:
+*  spi_master_init
+*
+** Description:
+*  This function enables the SPI peripheral in master operation. MOSI, SCK and SS are set as outputs and MISO as
+*  input. SS is set as output even if it isn't used as a chip select, since a low level on it while it's an input
+*  would switch the peripheral to slave operation.
+*
+** Input Parameters:
+*  - spi_mode: spi_mode_t
+*    This parameter selects the clock polarity and phase. For example: SPI_MODE_0.
+*  - spi_clock_divider: spi_clock_divider_t
+*    This parameter selects the SCK frequency. For example: SPI_CLOCK_DIV_16.
+*  - spi_data_order: spi_data_order_t
+*    This parameter selects which bit of each byte is sent first. For example: SPI_MSB_FIRST.
+*
+** Return Value:
+*  - spi_std_error_type_t
+*    The return value returns SPI_E_OK if all the passed configurations are correct, and returns "SPI_E_NOT_OK"
+*    otherwise.
+*********************************************************************************************************************/
+extern spi_std_error_type_t spi_master_init(spi_mode_t spi_mode, spi_clock_divider_t spi_clock_divider,
+                                            spi_data_order_t spi_data_order);
+
+/*********************************************************************************************************************
+** Function Name:
+*  spi_chip_select_init
+*
+** Description:
+*  This function configures the chip select pin of a slave as output, at the inactive (high) level.
+*
+** Input Parameters:
+*  - cs_port: gpio_port_t
+*    This parameter passes the port of the chip select pin. For example: GPIO_PORTB.
+*  - cs_pin: gpio_pin_t
+*    This parameter passes the chip select pin. For example: GPIO_PIN3.
+*
+** Return Value:
+*  - spi_std_error_type_t
+*    The return value returns SPI_E_OK if the pin is correct, and returns "SPI_E_NOT_OK" otherwise.
+*********************************************************************************************************************/
+extern spi_std_error_type_t spi_chip_select_init(gpio_port_t cs_port, gpio_pin_t cs_pin);
+
+/*********************************************************************************************************************
+** Function Name:
+*  spi_transaction_submit
+*
+** Description:
+*  This function adds a transaction to the master queue, and starts it right away if the bus is free. The bytes are
+*  then exchanged by the SPI interrupt, so the function returns without waiting. It can be called from a transaction
+*  complete callback to chain transactions. Note that the global interrupts need to be enabled.
+*
+** Input Parameters:
+*  - spi_transaction: spi_transaction_t*
+*    Passes the address of the transaction.
+*
+** Return Value:
+*  - spi_std_error_type_t
+*    The return value returns SPI_E_OK if the transaction is queued, and returns "SPI_E_NOT_OK" if it has no bytes,
+*    or the queue is full.
+*********************************************************************************************************************/
+extern spi_std_error_type_t spi_transaction_submit(spi_transaction_t* spi_transaction);
+
+/*********************************************************************************************************************
+** Function Name:
+*  spi_is_ready
+*
+** Description:
+*  This function returns whether all the queued transactions are complete.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - spi_is_ready_t
+*    Returns "SPI_READY" if the master queue is empty and the bus is free, and "SPI_NOT_READY" otherwise.
+*********************************************************************************************************************/
+extern spi_is_ready_t spi_is_ready(void);
+
+/*********************************************************************************************************************
+** Function Name:
+*  spi_transfer_polled
+*
+** Description:
+*  This function exchanges bytes with a slave and waits until they are all exchanged. At SPI_CLOCK_DIV_2 a byte takes
+*  only 16 CPU cycles, which is less than entering and leaving the SPI interrupt, so a polled loop is faster for short
+*  transfers. It can't be used while a queued transaction is in progress. Transactions submitted by interrupts while
+*  it's running wait in the queue, and are started when it returns.
+*
+** Input Parameters:
+*  - cs_port: gpio_port_t
+*    Passes the port of the chip select pin.
+*  - cs_pin: gpio_pin_t
+*    Passes the chip select pin.
+*  - tx_data: const uint8_t*
+*    Passes the bytes to transmit, or NULL to transmit SPI_DUMMY_BYTE.
+*  - rx_data: uint8_t*
+*    Passes the array to store the received bytes in, or NULL to ignore them.
+*  - length: uint16_t
+*    Passes the number of bytes to exchange.
+*
+** Return Value:
+*  - spi_std_error_type_t
+*    The return value returns SPI_E_OK if the bytes are exchanged, and returns "SPI_E_NOT_OK" if the bus is busy.
+*********************************************************************************************************************/
+extern spi_std_error_type_t spi_transfer_polled(gpio_port_t cs_port, gpio_pin_t cs_pin, const uint8_t* tx_data,
+                                                uint8_t* rx_data, uint16_t length);
+
+/*********************************************************************************************************************
+** Function Name:
+*  spi_slave_init
+*
+** Description:
+*  This function enables the SPI peripheral and its interrupt in slave operation. MISO is set as output, and SS, MOSI
+*  and SCK as inputs. Every byte received from the master is stored in the receive ring buffer, and at the same time 
+*  the next byte of the response buffer is loaded to be transmitted with the following byte.
+*  In slave operation, the next byte needs to be written in the few cycles between the end of a byte and the first
+*  SCK edge of the following one, so the interrupt writes it first, before doing anything else. The limits below are
+*  estimated by counting the cycles of the interrupt, not measured in a simulator or on hardware:
+*  - The interrupt writes the next byte about 25 CPU cycles after the end of a byte, so the master needs to wait at
+*    least that long between bytes (about 2 us at 12 MHz). Otherwise, the master reads back the byte it transmitted.
+*  - The whole interrupt takes about 70 CPU cycles, so a byte can't take less than that. The slave SCK also can't be
+*    faster than the CPU clock divided by 4. With the gap between bytes, a master clock of the CPU clock divided by 16
+*    (750 kHz at 12 MHz) is recommended as the maximum.
+*  - Other interrupts delay the SPI interrupt by up to their whole length, and the same goes for code that disables
+*    the interrupts, so the gap between bytes needs to be increased by the longest of them.
+*
+** Input Parameters:
+*  - spi_mode: spi_mode_t
+*    This parameter selects the clock polarity and phase used by the master.
+*  - spi_data_order: spi_data_order_t
+*    This parameter selects which bit of each byte is sent first.
+*  - rx_buffer: uint8_t*
+*    Passes the array to be used as the receive ring buffer. One of its bytes is always left empty, so it holds up to
+*    rx_buffer_size - 1 bytes. Bytes received while it's full are dropped.
+*  - rx_buffer_size: uint8_t
+*    Passes the size of the array, at least 2.
+*
+** Return Value:
+*  - spi_std_error_type_t
+*    The return value returns SPI_E_OK if all the passed configurations are correct, and returns "SPI_E_NOT_OK"
+*    otherwise.
+*********************************************************************************************************************/
+extern spi_std_error_type_t spi_slave_init(spi_mode_t spi_mode, spi_data_order_t spi_data_order, uint8_t* rx_buffer,
+                                           uint8_t rx_buffer_size);
+
+/*********************************************************************************************************************
+** Function Name:
+*  spi_slave_response_set
+*
+** Description:
+*  This function passes the bytes to be transmitted to the master in slave operation. If the slave isn't selected
+*  (SS is high), the first byte is loaded right away. Otherwise, the byte of the current transfer is already loaded,
+*  so the response starts from the following byte. After the last byte of the response, SPI_DUMMY_BYTE is 
+*  transmitted until a new response is set. The array isn't copied, so it needs to stay unchanged until it's 
+*  transmitted.
+*
+** Input Parameters:
+*  - response: const uint8_t*
+*    Passes the bytes to transmit.
+*  - response_length: uint8_t
+*    Passes the number of bytes to transmit.
+*
+** Return Value:
+*  - spi_std_error_type_t
+*    The return value returns SPI_E_OK if the response is set, and returns "SPI_E_NOT_OK" if the slave isn't
+*    initialized or the response is empty.
+*
+** Use Example:
+*  [1] Answer a status request received from the master:
+*      if ((SPI_E_OK == spi_slave_rx_buffer_read(&request)) && (STATUS_REQUEST == request))
+*      {
+*          spi_slave_response_set(status, sizeof(status));
+*      }
+*********************************************************************************************************************/
+extern spi_std_error_type_t spi_slave_response_set(const uint8_t* response, uint8_t response_length);
+
+/*********************************************************************************************************************
+** Function Name:
+*  spi_slave_rx_buffer_read
+*
+** Description:
+*  This function reads the oldest byte received from the master out of the receive ring buffer.
+*
+** Input Parameters:
+*  - data_byte: uint8_t*
+*    Passes the address to store the byte in.
+*
+** Return Value:
+*  - spi_std_error_type_t
+*    The return value returns SPI_E_OK if a byte is read, and returns "SPI_E_NOT_OK" if the buffer is empty.
+*********************************************************************************************************************/
+extern spi_std_error_type_t spi_slave_rx_buffer_read(uint8_t* data_byte);
+
+/*********************************************************************************************************************
+** Function Name:
+*  spi_slave_rx_buffer_count
+*
+** Description:
+*  This function returns the number of received bytes waiting in the receive ring buffer.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - uint8_t
+*    Returns the number of bytes in the buffer.
+*********************************************************************************************************************/
+extern uint8_t spi_slave_rx_buffer_count(void);
+
+
+
+#endif /* SPI_ATMEGA32_H_ */
+/*********************************************************************************************************************
+                                               << End of File >>
+*********************************************************************************************************************/
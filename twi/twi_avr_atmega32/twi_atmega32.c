@@ -0,0 +1,782 @@
+/*********************************************************************************************************************
+* Author : Alsayed Alsisi
+* Date   : Thursday, May 06, 2021
+* Version: 1.0
+* Contact: alsayed.alsisi@gmail.com
+* License:
+* You have the right to use the file as you wish in any educational or commercial purposes under the following
+* conditions:
+* [1] This file is to be used as is. No modifications are to be made to any part of the file, including this section.
+* [2] This section is not to be removed under any circumstances.
+* [3] Parts of the file may be used separately under the condition they are not modified, and preceded by this section.
+* [4] Any bug encountered in this file or parts of it should be reported to the email address given above to be fixed.
+* [5] No warranty is expressed or implied by the publication or distribution of this source code.
+*********************************************************************************************************************/
+/*********************************************************************************************************************
+* File Information:
+** File Name:
+*  twi_atmega32.c
+*
+** Description:
+*  This file contains the implementation for the device driver of TWI peripheral of the atmega32 microcontroller.
+*********************************************************************************************************************/
+
+
+/*********************************************************************************************************************
+                                               << File Inclusions >>
+*********************************************************************************************************************/
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <util/atomic.h>
+#include <stdint.h>
+#include <stddef.h>
+#include "twi_atmega32.h"
+#include "bit_math.h"
+
+/*********************************************************************************************************************
+                                              << Private Constants >>
+*********************************************************************************************************************/
+#define   INITIALIZE_TO_ZERO             (0U)
+
+/* Bit rate calculation: SCL = clock / (16 + 2 * TWBR * 4^TWPS) */
+#define   TWI_SCL_FIXED_CYCLES           (16UL)
+#define   TWI_TWBR_MIN                   (10UL)    /* Lowest TWBR allowed in master operation */
+#define   TWI_TWBR_MAX                   (255UL)
+#define   TWI_PRESCALER_COUNT            (4U)      /* TWPS1:0 = 1, 4, 16, 64 */
+#define   TWI_SLAVE_ADDRESS_MAX          (0x7FU)
+#define   TWI_READ_BIT                   (0x01U)   /* Last bit of SLA+R/W */
+
+/* Status codes (TWSR with the prescaler bits masked out): */
+#define   TWI_STATUS_MASK                (0xF8U)
+#define   TWI_BUS_ERROR                  (0x00U)
+#define   TWI_START                      (0x08U)
+#define   TWI_REPEATED_START             (0x10U)
+#define   TWI_MT_SLA_ACK                 (0x18U)
+#define   TWI_MT_SLA_NACK                (0x20U)
+#define   TWI_MT_DATA_ACK                (0x28U)
+#define   TWI_MT_DATA_NACK               (0x30U)
+#define   TWI_ARBITRATION_LOST           (0x38U)
+#define   TWI_MR_SLA_ACK                 (0x40U)
+#define   TWI_MR_SLA_NACK                (0x48U)
+#define   TWI_MR_DATA_ACK                (0x50U)
+#define   TWI_MR_DATA_NACK               (0x58U)
+#define   TWI_SR_SLA_ACK                 (0x60U)   /* Own SLA+W received */
+#define   TWI_SR_ARBITRATION_SLA_ACK     (0x68U)   /* Arbitration lost as master, then own SLA+W received */
+#define   TWI_SR_DATA_ACK                (0x80U)
+#define   TWI_SR_DATA_NACK               (0x88U)
+#define   TWI_SR_STOP                    (0xA0U)   /* STOP or repeated START while addressed */
+#define   TWI_ST_SLA_ACK                 (0xA8U)   /* Own SLA+R received */
+#define   TWI_ST_ARBITRATION_SLA_ACK     (0xB0U)   /* Arbitration lost as master, then own SLA+R received */
+#define   TWI_ST_DATA_ACK                (0xB8U)
+#define   TWI_ST_DATA_NACK               (0xC0U)
+#define   TWI_ST_LAST_DATA_ACK           (0xC8U)
+#define   TWI_SLAVE_STATUS_FIRST         TWI_SR_SLA_ACK
+
+/* TWCR values. Writing TWINT as one clears the flag, which starts the next bus action: */
+#define   TWI_CONTROL_CONTINUE           ((1<<TWINT)|(1<<TWEN)|(1<<TWIE))
+#define   TWI_CONTROL_ACK                (TWI_CONTROL_CONTINUE|(1<<TWEA))
+#define   TWI_CONTROL_START              (TWI_CONTROL_CONTINUE|(1<<TWSTA))
+#define   TWI_CONTROL_STOP               (TWI_CONTROL_CONTINUE|(1<<TWSTO))
+#define   TWI_CONTROL_STOP_START         (TWI_CONTROL_CONTINUE|(1<<TWSTO)|(1<<TWSTA))
+
+/* One entry more than the queue size, so that a full queue can be told from an empty one: */
+#define   TWI_QUEUE_ENTRIES              (TWI_QUEUE_SIZE + 1U)
+
+/*********************************************************************************************************************
+                                              << Private Data Types >>
+*********************************************************************************************************************/
+
+
+/*********************************************************************************************************************
+                                          << Private Variable Definitions >>
+*********************************************************************************************************************/
+/* Master transaction queue. The transactions are owned by the application, the queue only holds their addresses: */
+static twi_transaction_t* g_twi_queue[TWI_QUEUE_ENTRIES];
+static volatile uint8_t g_twi_queue_head = INITIALIZE_TO_ZERO;   /* Next free entry */
+static volatile uint8_t g_twi_queue_tail = INITIALIZE_TO_ZERO;   /* Next transaction to start */
+
+/* Transaction in progress, or NULL when the master is idle: */
+static twi_transaction_t* volatile g_twi_current = NULL;
+static uint8_t g_twi_index = INITIALIZE_TO_ZERO;   /* Next byte to write or read */
+
+/* TWEA while the slave is enabled, added to the master START, STOP, address and data writes so the own address stays
+   recognized if the arbitration is lost. The master receiver writes set or clear TWEA themselves to ACK or NACK: */
+static uint8_t g_twi_slave_control = INITIALIZE_TO_ZERO;
+
+/* Slave register map. The master reads the front buffer, the application writes the other one: */
+static uint8_t* g_twi_slave_registers[2] = {NULL, NULL};
+static uint8_t g_twi_slave_register_count = INITIALIZE_TO_ZERO;
+static void (*g_twi_slave_write_callback)(uint8_t register_address, uint8_t value) = NULL;
+static volatile uint8_t g_twi_slave_front = INITIALIZE_TO_ZERO;             /* Index of the front buffer */
+static volatile uint8_t g_twi_slave_publish_pending = INITIALIZE_TO_ZERO;   /* Swap waiting for a read to end */
+static volatile uint8_t g_twi_slave_back_stale = INITIALIZE_TO_ZERO;        /* Back buffer older than the front */
+static volatile uint8_t g_twi_slave_reading = INITIALIZE_TO_ZERO;           /* Master read in progress */
+static uint8_t g_twi_slave_pointer = INITIALIZE_TO_ZERO;                    /* Next register to read or write */
+static uint8_t g_twi_slave_pointer_expected = INITIALIZE_TO_ZERO;           /* Next byte written sets the pointer */
+
+/*********************************************************************************************************************
+                                          << Public Variable Definitions >>
+*********************************************************************************************************************/
+
+
+/*********************************************************************************************************************
+                                         << Private Functions Prototypes >>
+*********************************************************************************************************************/
+static void twi_transaction_dequeue(void);
+static void twi_transaction_complete(twi_transaction_status_t twi_transaction_status);
+static inline void twi_master_event_handle(uint8_t twi_status);
+static void twi_slave_registers_swap(void);
+static void twi_slave_register_transmit(void);
+static void twi_slave_transaction_end(void);
+static inline void twi_slave_event_handle(uint8_t twi_status);
+
+/*********************************************************************************************************************
+                                          << Public Function Definitions >>
+*********************************************************************************************************************/
+/*********************************************************************************************************************
+** Function Name:
+*  twi_master_init
+*
+** Description:
+*  This function calculates the bit rate register and the prescaler for the SCL frequency, and enables the TWI
+*  peripheral and its interrupt.
+*
+** Input Parameters:
+*  - scl_frequency: uint32_t
+*    This parameter is used to select the SCL frequency in Hz.
+*  - sys_osc_clock_freq: uint32_t
+*    This parameter is used to pass the microcontroller's clock frequency in HZ to the function.
+*
+** Return Value:
+*  - twi_std_error_type_t
+*    The return value returns TWI_E_OK if the SCL frequency can be generated, and returns "TWI_E_NOT_OK" otherwise.
+*********************************************************************************************************************/
+twi_std_error_type_t twi_master_init(uint32_t scl_frequency, uint32_t sys_osc_clock_freq)
+{
+	twi_std_error_type_t return_error = TWI_E_NOT_OK;
+	uint32_t clock_ratio = INITIALIZE_TO_ZERO;
+	uint32_t bit_rate_divider = INITIALIZE_TO_ZERO;
+	uint32_t bit_rate_register_value = INITIALIZE_TO_ZERO;
+	uint8_t prescaler = INITIALIZE_TO_ZERO;
+
+	if (INITIALIZE_TO_ZERO != scl_frequency)
+	{
+		/* CPU cycles per SCL period, rounded up so the SCL frequency is never higher than requested: */
+		clock_ratio = (sys_osc_clock_freq + scl_frequency - 1UL) / scl_frequency;
+		if ((TWI_SCL_FIXED_CYCLES + (2UL * TWI_TWBR_MIN)) <= clock_ratio)
+		{
+			for (prescaler = 0; prescaler < TWI_PRESCALER_COUNT; prescaler++)
+			{
+				bit_rate_divider = 2UL << (2U * prescaler);   /* 2 * 4^TWPS */
+				bit_rate_register_value = ((clock_ratio - TWI_SCL_FIXED_CYCLES) + bit_rate_divider - 1UL) /
+				                          bit_rate_divider;
+				if (TWI_TWBR_MAX >= bit_rate_register_value)
+				{
+					TWBR = (uint8_t)bit_rate_register_value;
+					TWSR = prescaler;   /* Only TWPS1:0 are writable */
+					TWCR = (1<<TWEN) | (1<<TWIE) | g_twi_slave_control;
+					return_error = TWI_E_OK;
+					break;
+				}
+			}
+		}
+	}
+
+	return return_error;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  twi_transaction_submit
+*
+** Description:
+*  This function adds a transaction to the master queue, and sends a START condition if the master is idle. If a
+*  slave event is waiting for the TWI interrupt, the START is sent by the interrupt at the end of the slave
+*  transaction instead, so the event isn't lost.
+*
+** Input Parameters:
+*  - twi_transaction: twi_transaction_t*
+*    Passes the address of the transaction.
+*
+** Return Value:
+*  - twi_std_error_type_t
+*    The return value returns TWI_E_OK if the transaction is queued, and returns "TWI_E_NOT_OK" otherwise.
+*********************************************************************************************************************/
+twi_std_error_type_t twi_transaction_submit(twi_transaction_t* twi_transaction)
+{
+	twi_std_error_type_t return_error = TWI_E_NOT_OK;
+	uint8_t next_head = INITIALIZE_TO_ZERO;
+
+	if ((NULL != twi_transaction) && (TWI_SLAVE_ADDRESS_MAX >= twi_transaction->address) &&
+	    ((INITIALIZE_TO_ZERO != twi_transaction->tx_length) || (INITIALIZE_TO_ZERO != twi_transaction->rx_length)))
+	{
+		/* The queue is also changed by the TWI interrupt, and by other interrupts that submit transactions: */
+		ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+		{
+			next_head = g_twi_queue_head + 1U;
+			if (TWI_QUEUE_ENTRIES == next_head)
+			{
+				next_head = INITIALIZE_TO_ZERO;
+			}
+
+			if (next_head != g_twi_queue_tail)
+			{
+				twi_transaction->status = TWI_TRANSACTION_PENDING;
+				g_twi_queue[g_twi_queue_head] = twi_transaction;
+				g_twi_queue_head = next_head;
+				if (NULL == g_twi_current)
+				{
+					twi_transaction_dequeue();
+					/* Writing TWINT would clear a pending slave event before the interrupt handles it: */
+					if (INITIALIZE_TO_ZERO == BIT_GET(TWCR, TWINT))
+					{
+						TWCR = TWI_CONTROL_START | g_twi_slave_control;
+					}
+				}
+				return_error = TWI_E_OK;
+			}
+			else
+			{
+				return_error = TWI_E_NOT_OK;  /* Queue full */
+			}
+		}
+	}
+	else
+	{
+		return_error = TWI_E_NOT_OK;
+	}
+
+	return return_error;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  twi_is_ready
+*
+** Description:
+*  This function returns whether all the queued transactions are complete.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - twi_is_ready_t
+*    Returns "TWI_READY" if no transaction is queued or in progress, and "TWI_NOT_READY" otherwise.
+*********************************************************************************************************************/
+twi_is_ready_t twi_is_ready(void)
+{
+	twi_is_ready_t is_ready = TWI_NOT_READY;
+
+	/* The master stays busy until the last transaction of the queue is complete: */
+	if (NULL == g_twi_current)
+	{
+		is_ready = TWI_READY;
+	}
+
+	return is_ready;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  twi_slave_init
+*
+** Description:
+*  This function sets the own slave address and the register map, and enables the acknowledge of the own address.
+*
+** Input Parameters:
+*  - slave_address: uint8_t
+*    Passes the 7-bit address of the slave.
+*  - register_buffer_0: uint8_t*
+*    Passes the first register buffer, which is the front buffer at first.
+*  - register_buffer_1: uint8_t*
+*    Passes the second register buffer.
+*  - register_count: uint8_t
+*    Passes the number of registers in each buffer.
+*  - register_write_callback: void (*)(uint8_t register_address, uint8_t value)
+*    Passes the function called for each register written by the master, or NULL.
+*
+** Return Value:
+*  - twi_std_error_type_t
+*    The return value returns TWI_E_OK if all the passed configurations are correct, and returns "TWI_E_NOT_OK"
+*    otherwise.
+*********************************************************************************************************************/
+twi_std_error_type_t twi_slave_init(uint8_t slave_address, uint8_t* register_buffer_0, uint8_t* register_buffer_1,
+                                    uint8_t register_count,
+                                    void (*register_write_callback)(uint8_t register_address, uint8_t value))
+{
+	twi_std_error_type_t return_error = TWI_E_NOT_OK;
+
+	/* Address 0 is the general call address, which isn't answered: */
+	if ((INITIALIZE_TO_ZERO != slave_address) && (TWI_SLAVE_ADDRESS_MAX >= slave_address) &&
+	    (NULL != register_buffer_0) && (NULL != register_buffer_1) && (register_buffer_0 != register_buffer_1) &&
+	    (INITIALIZE_TO_ZERO != register_count))
+	{
+		ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+		{
+			g_twi_slave_registers[0] = register_buffer_0;
+			g_twi_slave_registers[1] = register_buffer_1;
+			g_twi_slave_register_count = register_count;
+			g_twi_slave_write_callback = register_write_callback;
+			g_twi_slave_front = INITIALIZE_TO_ZERO;
+			g_twi_slave_publish_pending = INITIALIZE_TO_ZERO;
+			g_twi_slave_back_stale = 1U;   /* The second buffer gets the initial values on the first get */
+			g_twi_slave_reading = INITIALIZE_TO_ZERO;
+			g_twi_slave_pointer = INITIALIZE_TO_ZERO;
+
+			TWAR = (uint8_t)(slave_address << 1);   /* TWGCE = 0: the general call isn't answered */
+			g_twi_slave_control = (1<<TWEA);
+			/* A master transaction in progress gets TWEA with its STOP, and a pending event gets it from the interrupt,
+			   so TWCR is only written while both are idle: */
+			if ((NULL == g_twi_current) && (INITIALIZE_TO_ZERO == BIT_GET(TWCR, TWINT)))
+			{
+				TWCR = (1<<TWEN) | (1<<TWIE) | (1<<TWEA);
+			}
+		}
+		return_error = TWI_E_OK;
+	}
+	else
+	{
+		return_error = TWI_E_NOT_OK;
+	}
+
+	return return_error;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  twi_slave_registers_get
+*
+** Description:
+*  This function returns the back register buffer. After a swap, the back buffer holds an older snapshot, so the
+*  front buffer is copied to it first. The copy is done here, in the main loop, rather than in the TWI interrupt.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - uint8_t*
+*    Returns the back buffer, or NULL if the slave isn't initialized or a swap is still pending.
+*********************************************************************************************************************/
+uint8_t* twi_slave_registers_get(void)
+{
+	uint8_t* back_buffer = NULL;
+	const uint8_t* front_buffer = NULL;
+	uint8_t register_index = INITIALIZE_TO_ZERO;
+
+	/* The interrupt only swaps the buffers while a publish is pending, so the front buffer doesn't change here: */
+	if ((NULL != g_twi_slave_registers[0]) && (INITIALIZE_TO_ZERO == g_twi_slave_publish_pending))
+	{
+		front_buffer = g_twi_slave_registers[g_twi_slave_front];
+		back_buffer = g_twi_slave_registers[g_twi_slave_front ^ 1U];
+		if (INITIALIZE_TO_ZERO != g_twi_slave_back_stale)
+		{
+			for (register_index = 0; register_index < g_twi_slave_register_count; register_index++)
+			{
+				back_buffer[register_index] = front_buffer[register_index];
+			}
+			g_twi_slave_back_stale = INITIALIZE_TO_ZERO;
+		}
+	}
+
+	return back_buffer;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  twi_slave_registers_publish
+*
+** Description:
+*  This function swaps the register buffers, or leaves the swap to the TWI interrupt if a master read is in progress.
+*  A publish without a twi_slave_registers_get since the last one is ignored, so a buffer the master is reading is
+*  never swapped back.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+void twi_slave_registers_publish(void)
+{
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		if ((NULL != g_twi_slave_registers[0]) && (INITIALIZE_TO_ZERO == g_twi_slave_publish_pending) &&
+		    (INITIALIZE_TO_ZERO == g_twi_slave_back_stale))
+		{
+			if (INITIALIZE_TO_ZERO != g_twi_slave_reading)
+			{
+				g_twi_slave_publish_pending = 1U;
+			}
+			else
+			{
+				twi_slave_registers_swap();
+			}
+		}
+	}
+}
+
+
+/*********************************************************************************************************************
+                                          << Private Function Definitions >>
+*********************************************************************************************************************/
+/*********************************************************************************************************************
+** Function Name:
+*  twi_transaction_dequeue
+*
+** Description:
+*  This function makes the oldest transaction of the master queue the current one. It's called with the interrupts
+*  disabled, and only when the queue isn't empty.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+static void twi_transaction_dequeue(void)
+{
+	g_twi_current = g_twi_queue[g_twi_queue_tail];
+	g_twi_queue_tail++;
+	if (TWI_QUEUE_ENTRIES == g_twi_queue_tail)
+	{
+		g_twi_queue_tail = INITIALIZE_TO_ZERO;
+	}
+	g_twi_index = INITIALIZE_TO_ZERO;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  twi_transaction_complete
+*
+** Description:
+*  This function ends the current transaction with a STOP condition and stores its result. If another transaction
+*  is queued, the STOP is followed by a START for it, in the same TWCR write. Then the complete callback is called.
+*
+** Input Parameters:
+*  - twi_transaction_status: twi_transaction_status_t
+*    Passes the result of the transaction.
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+static void twi_transaction_complete(twi_transaction_status_t twi_transaction_status)
+{
+	twi_transaction_t* transaction = g_twi_current;
+
+	if (g_twi_queue_head != g_twi_queue_tail)
+	{
+		twi_transaction_dequeue();
+		TWCR = TWI_CONTROL_STOP_START | g_twi_slave_control;
+	}
+	else
+	{
+		g_twi_current = NULL;
+		TWCR = TWI_CONTROL_STOP | g_twi_slave_control;
+	}
+
+	transaction->status = twi_transaction_status;
+	if (NULL != transaction->complete_callback)
+	{
+		transaction->complete_callback();
+	}
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  twi_master_event_handle
+*
+** Description:
+*  This function is the master state machine. It's called by the TWI interrupt each time the peripheral finishes a
+*  bus action, and starts the next one according to the status code:
+*  START -> SLA+W -> data bytes -> (repeated START -> SLA+R -> data bytes) -> STOP.
+*  The last byte read is answered with a NACK, which tells the slave to release the bus.
+*
+** Input Parameters:
+*  - twi_status: uint8_t
+*    Passes the status code.
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+static inline void twi_master_event_handle(uint8_t twi_status)
+{
+	twi_transaction_t* transaction = g_twi_current;
+
+	switch (twi_status)
+	{
+		case TWI_START:
+		g_twi_index = INITIALIZE_TO_ZERO;
+		if (INITIALIZE_TO_ZERO != transaction->tx_length)
+		{
+			TWDR = (uint8_t)(transaction->address << 1);
+		}
+		else
+		{
+			TWDR = (uint8_t)(transaction->address << 1) | TWI_READ_BIT;
+		}
+		TWCR = TWI_CONTROL_CONTINUE | g_twi_slave_control;
+		break;
+
+		case TWI_REPEATED_START:
+		g_twi_index = INITIALIZE_TO_ZERO;
+		TWDR = (uint8_t)(transaction->address << 1) | TWI_READ_BIT;
+		TWCR = TWI_CONTROL_CONTINUE | g_twi_slave_control;
+		break;
+
+		case TWI_MT_SLA_ACK:
+		case TWI_MT_DATA_ACK:
+		if (transaction->tx_length != g_twi_index)
+		{
+			TWDR = transaction->tx_data[g_twi_index];
+			g_twi_index++;
+			TWCR = TWI_CONTROL_CONTINUE | g_twi_slave_control;
+		}
+		else if (INITIALIZE_TO_ZERO != transaction->rx_length)
+		{
+			TWCR = TWI_CONTROL_START | g_twi_slave_control;   /* Repeated START */
+		}
+		else
+		{
+			twi_transaction_complete(TWI_TRANSACTION_DONE);
+		}
+		break;
+
+		case TWI_MR_SLA_ACK:
+		/* Acknowledging every byte except the last one: */
+		if (1U < transaction->rx_length)
+		{
+			TWCR = TWI_CONTROL_ACK;
+		}
+		else
+		{
+			TWCR = TWI_CONTROL_CONTINUE;
+		}
+		break;
+
+		case TWI_MR_DATA_ACK:
+		transaction->rx_data[g_twi_index] = TWDR;
+		g_twi_index++;
+		if ((transaction->rx_length - 1U) > g_twi_index)
+		{
+			TWCR = TWI_CONTROL_ACK;
+		}
+		else
+		{
+			TWCR = TWI_CONTROL_CONTINUE;
+		}
+		break;
+
+		case TWI_MR_DATA_NACK:
+		transaction->rx_data[g_twi_index] = TWDR;
+		twi_transaction_complete(TWI_TRANSACTION_DONE);
+		break;
+
+		case TWI_MT_SLA_NACK:
+		case TWI_MR_SLA_NACK:
+		twi_transaction_complete(TWI_TRANSACTION_ADDRESS_NACK);
+		break;
+
+		case TWI_MT_DATA_NACK:
+		twi_transaction_complete(TWI_TRANSACTION_DATA_NACK);
+		break;
+
+		case TWI_ARBITRATION_LOST:
+		/* Another master took the bus. The transaction is started again once the bus is free: */
+		TWCR = TWI_CONTROL_START | g_twi_slave_control;
+		break;
+
+		case TWI_BUS_ERROR:
+		default:
+		twi_transaction_complete(TWI_TRANSACTION_BUS_ERROR);
+		break;
+	}
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  twi_slave_registers_swap
+*
+** Description:
+*  This function makes the back register buffer the front one. It's called with the interrupts disabled, while no
+*  master read is in progress.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+static void twi_slave_registers_swap(void)
+{
+	g_twi_slave_front ^= 1U;
+	g_twi_slave_publish_pending = INITIALIZE_TO_ZERO;
+	g_twi_slave_back_stale = 1U;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  twi_slave_register_transmit
+*
+** Description:
+*  This function loads the register at the pointer from the front buffer into the data register, and increments the
+*  pointer, which stops at the end of the register map.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+static void twi_slave_register_transmit(void)
+{
+	if (g_twi_slave_register_count > g_twi_slave_pointer)
+	{
+		TWDR = g_twi_slave_registers[g_twi_slave_front][g_twi_slave_pointer];
+		g_twi_slave_pointer++;
+	}
+	else
+	{
+		TWDR = TWI_SLAVE_PADDING_BYTE;
+	}
+	TWCR = TWI_CONTROL_ACK;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  twi_slave_transaction_end
+*
+** Description:
+*  This function switches the slave back to recognizing its own address at the end of a slave transaction. If a
+*  master transaction is waiting, because the bus was busy or the arbitration was lost, a START is sent for it once
+*  the bus is free.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+static void twi_slave_transaction_end(void)
+{
+	if (NULL != g_twi_current)
+	{
+		TWCR = TWI_CONTROL_ACK | (1<<TWSTA);
+	}
+	else
+	{
+		TWCR = TWI_CONTROL_ACK;
+	}
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  twi_slave_event_handle
+*
+** Description:
+*  This function is the slave state machine. It's called by the TWI interrupt for the slave status codes:
+*  - Write: SLA+W -> register pointer -> register values -> STOP.
+*  - Read: SLA+R -> register values -> NACK from the master.
+*  Every byte is answered here, from the front buffer, so a read never waits for the main loop. A pending swap is
+*  done when a read ends or before the next one starts.
+*
+** Input Parameters:
+*  - twi_status: uint8_t
+*    Passes the status code.
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+static inline void twi_slave_event_handle(uint8_t twi_status)
+{
+	uint8_t received_byte = INITIALIZE_TO_ZERO;
+
+	switch (twi_status)
+	{
+		case TWI_SR_SLA_ACK:
+		case TWI_SR_ARBITRATION_SLA_ACK:
+		g_twi_slave_pointer_expected = 1U;
+		TWCR = TWI_CONTROL_ACK;
+		break;
+
+		case TWI_SR_DATA_ACK:
+		received_byte = TWDR;
+		if (INITIALIZE_TO_ZERO != g_twi_slave_pointer_expected)
+		{
+			g_twi_slave_pointer = received_byte;
+			g_twi_slave_pointer_expected = INITIALIZE_TO_ZERO;
+		}
+		else if (g_twi_slave_register_count > g_twi_slave_pointer)
+		{
+			if (NULL != g_twi_slave_write_callback)
+			{
+				g_twi_slave_write_callback(g_twi_slave_pointer, received_byte);
+			}
+			g_twi_slave_pointer++;
+		}
+		else
+		{
+			/* Past the end of the register map, the byte is ignored */
+		}
+		TWCR = TWI_CONTROL_ACK;
+		break;
+
+		case TWI_ST_SLA_ACK:
+		case TWI_ST_ARBITRATION_SLA_ACK:
+		if (INITIALIZE_TO_ZERO != g_twi_slave_publish_pending)
+		{
+			twi_slave_registers_swap();
+		}
+		g_twi_slave_reading = 1U;
+		twi_slave_register_transmit();
+		break;
+
+		case TWI_ST_DATA_ACK:
+		twi_slave_register_transmit();
+		break;
+
+		case TWI_ST_DATA_NACK:
+		case TWI_ST_LAST_DATA_ACK:
+		g_twi_slave_reading = INITIALIZE_TO_ZERO;
+		if (INITIALIZE_TO_ZERO != g_twi_slave_publish_pending)
+		{
+			twi_slave_registers_swap();
+		}
+		twi_slave_transaction_end();
+		break;
+
+		case TWI_SR_DATA_NACK:
+		case TWI_SR_STOP:
+		default:
+		twi_slave_transaction_end();
+		break;
+	}
+}
+
+/*********************************************************************************************************************
+Interrupt service routine definition for the TWI interrupt, which fires each time the peripheral finishes a bus
+action.
+*********************************************************************************************************************/
+ISR(TWI_vect)
+{
+	uint8_t twi_status = TWSR & TWI_STATUS_MASK;
+
+	/* The slave status codes are all above the master ones, and can come while a master transaction is waiting: */
+	if (TWI_SLAVE_STATUS_FIRST <= twi_status)
+	{
+		twi_slave_event_handle(twi_status);
+	}
+	else if (NULL != g_twi_current)
+	{
+		twi_master_event_handle(twi_status);
+	}
+	else
+	{
+		/* Not expected while the master is idle. The flag is cleared, and the bus released: */
+		g_twi_slave_reading = INITIALIZE_TO_ZERO;
+		TWCR = TWI_CONTROL_STOP | g_twi_slave_control;
+	}
+}
+
+/*********************************************************************************************************************
+                                                << End of File >>
+*********************************************************************************************************************/
@@ -0,0 +1,282 @@
+/*********************************************************************************************************************
+* Author : Alsayed Alsisi
+* Date   : Thursday, May 06, 2021
+* Version: 1.0
+* Contact: alsayed.alsisi@gmail.com
+* License:
+* You have the right to use the file as you wish in any educational or commercial purposes under the following
+* conditions:
+* [1] This file is to be used as is. No modifications are to be made to any part of the file, including this section.
+* [2] This section is not to be removed under any circumstances.
+* [3] Parts of the file may be used separately under the condition they are not modified, and preceded by this section.
+* [4] Any bug encountered in this file or parts of it should be reported to the email address given above to be fixed.
+* [5] No warranty is expressed or implied by the publication or distribution of this source code.
+*********************************************************************************************************************/
+/*********************************************************************************************************************
+* File Information:
+** File Name:
+*  twi_atmega32.h
+*
+** Description:
+*  This file contains the public programming interfaces for the device driver of TWI (I2C) peripheral of the
+*  atmega32 microcontroller. In master operation, transfers are queued as transactions and run completely by the TWI
+*  interrupt, so the CPU never waits for the bus. In slave operation, the driver serves a register map to the master
+*  from the TWI interrupt, without involving the main loop.
+*  The TWI pins are SCL = PC0 and SDA = PC1. The bus needs pull-up resistors, usually 4.7 kOhm for 100 kHz and
+*  2.2 kOhm for 400 kHz.
+*********************************************************************************************************************/
+
+
+/*********************************************************************************************************************
+                                               << Header Guard >>
+*********************************************************************************************************************/
+#ifndef TWI_ATMEGA32_H_
+#define TWI_ATMEGA32_H_
+
+/*********************************************************************************************************************
+                                               << File Inclusions >>
+*********************************************************************************************************************/
+#include <stdint.h>
+
+/*********************************************************************************************************************
+                                               << Public Constants >>
+*********************************************************************************************************************/
+/* Standard SCL frequencies in Hz: */
+#define   TWI_SCL_100KHZ                    (100000UL)
+#define   TWI_SCL_400KHZ                    (400000UL)
+
+/* Maximum number of transactions waiting in the master queue, not including the one in progress: */
+#define   TWI_QUEUE_SIZE                    (8U)
+
+/* Byte returned to the master when it reads past the end of the slave register map: */
+#define   TWI_SLAVE_PADDING_BYTE            (0xFFU)
+
+
+/*********************************************************************************************************************
+                                               << Public Data Types >>
+*********************************************************************************************************************/
+typedef enum
+{
+	TWI_E_OK = 0,
+	TWI_E_NOT_OK = 1
+	} twi_std_error_type_t;
+
+typedef enum
+{
+	TWI_NOT_READY = 0,
+	TWI_READY = 1
+	} twi_is_ready_t;
+
+/* Result of a master transaction: */
+typedef enum
+{
+	TWI_TRANSACTION_PENDING = 0,     /* Queued or in progress */
+	TWI_TRANSACTION_DONE,            /* All the bytes were transferred */
+	TWI_TRANSACTION_ADDRESS_NACK,    /* No slave answered the address */
+	TWI_TRANSACTION_DATA_NACK,       /* The slave didn't accept a written byte */
+	TWI_TRANSACTION_BUS_ERROR        /* An illegal START or STOP was detected on the bus */
+	} twi_transaction_status_t;
+
+/*********************************************************************************************************************
+** Datatype Name:
+*  twi_transaction_t
+*
+** Description:
+*  This is a structure datatype that describes one transfer with a slave in master operation. The bytes of tx_data
+*  are written first, then, after a repeated start, the bytes of rx_data are read, and the transfer ends with a STOP.
+*  Either part can be empty, so the same structure describes a write, a read, or a register read (write the register
+*  address, then read). The driver keeps a pointer to the structure, so it and its buffers need to stay unchanged
+*  until the transaction is complete.
+*
+** Datatype Elements:
+*  [1] address: uint8_t
+*      The 7-bit address of the slave, not shifted.
+*  [2] tx_data: const uint8_t*
+*      The bytes to write.
+*  [3] tx_length: uint8_t
+*      The number of bytes to write, or 0 for a read only.
+*  [4] rx_data: uint8_t*
+*      The array to store the read bytes in.
+*  [5] rx_length: uint8_t
+*      The number of bytes to read, or 0 for a write only.
+*  [6] status: twi_transaction_status_t
+*      Set by the driver: TWI_TRANSACTION_PENDING when it's submitted, then the result once it's complete.
+*  [7] complete_callback: void (*)(void)
+*      The function to be called from the TWI interrupt once the transaction is complete, or NULL.
+*
+** Use Example:
+*  [1] Read 2 bytes from register 0x05 of a sensor at address 0x48:
+*      static const uint8_t register_address = 0x05;
+*      static uint8_t temperature[2];
+*      static twi_transaction_t read = {0x48, &register_address, 1, temperature, 2, TWI_TRANSACTION_PENDING, NULL};
+*      twi_transaction_submit(&read);
+*      ...
+*      if (TWI_TRANSACTION_DONE == read.status) {...}
+*********************************************************************************************************************/
+typedef struct
+{
+	uint8_t address;
+	const uint8_t* tx_data;
+	uint8_t tx_length;
+	uint8_t* rx_data;
+	uint8_t rx_length;
+	volatile twi_transaction_status_t status;
+	void (*complete_callback)(void);
+} twi_transaction_t;
+
+/*********************************************************************************************************************
+                                           << Public Function Declarations >>
+*********************************************************************************************************************/
+/*********************************************************************************************************************
+** Function Name:
+*  twi_master_init
+*
+** Description:
+*  This function enables the TWI peripheral and its interrupt, and sets the SCL frequency. The bit rate register and
+*  the prescaler are calculated as: SCL = sys_osc_clock_freq / (16 + 2 * TWBR * 4^TWPS), using the smallest
+*  prescaler, and rounding towards a lower SCL frequency. The ATmega32 datasheet requires TWBR to be 10 or higher in
+*  master operation, so the highest SCL frequency is sys_osc_clock_freq / 36: 400 kHz needs a clock of at least
+*  14.4 MHz, and 100 kHz at least 3.6 MHz.
+*
+** Input Parameters:
+*  - scl_frequency: uint32_t
+*    This parameter is used to select the SCL frequency in Hz. For example: TWI_SCL_100KHZ.
+*  - sys_osc_clock_freq: uint32_t
+*    This parameter is used to pass the microcontroller's clock frequency in HZ to the function.
+*
+** Return Value:
+*  - twi_std_error_type_t
+*    The return value returns TWI_E_OK if the SCL frequency can be generated, and returns "TWI_E_NOT_OK" if it's too
+*    high or too low for the clock frequency.
+*********************************************************************************************************************/
+extern twi_std_error_type_t twi_master_init(uint32_t scl_frequency, uint32_t sys_osc_clock_freq);
+
+/*********************************************************************************************************************
+** Function Name:
+*  twi_transaction_submit
+*
+** Description:
+*  This function adds a transaction to the master queue, and starts it right away if the bus is free. The function
+*  returns without waiting, and the status of the transaction is updated by the TWI interrupt. It can be called from
+*  a transaction complete callback to chain transactions. Note that the global interrupts need to be enabled.
+*
+** Input Parameters:
+*  - twi_transaction: twi_transaction_t*
+*    Passes the address of the transaction.
+*
+** Return Value:
+*  - twi_std_error_type_t
+*    The return value returns TWI_E_OK if the transaction is queued, and returns "TWI_E_NOT_OK" if it has no bytes,
+*    a wrong address, or the queue is full.
+*********************************************************************************************************************/
+extern twi_std_error_type_t twi_transaction_submit(twi_transaction_t* twi_transaction);
+
+/*********************************************************************************************************************
+** Function Name:
+*  twi_is_ready
+*
+** Description:
+*  This function returns whether all the queued transactions are complete.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - twi_is_ready_t
+*    Returns "TWI_READY" if the master queue is empty and no transaction is in progress, and "TWI_NOT_READY"
+*    otherwise.
+*********************************************************************************************************************/
+extern twi_is_ready_t twi_is_ready(void);
+
+/*********************************************************************************************************************
+** Function Name:
+*  twi_slave_init
+*
+** Description:
+*  This function enables the TWI slave at the given address, serving a register map to the master. It can be used
+*  together with the master operation, and doesn't need twi_master_init otherwise. The ATmega32 datasheet requires
+*  the CPU clock to be at least 16 times the SCL frequency in slave operation.
+*  - A master write starts with the register address, which sets the register pointer. Each following byte is
+*    passed to the register write callback with the register address it's written to, and the pointer is incremented.
+*  - A master read returns the registers from the pointer on, incrementing the pointer after each byte. Reading past
+*    the last register returns TWI_SLAVE_PADDING_BYTE.
+*  - The registers read by the master are double-buffered. The application writes the next values into the back
+*    buffer, returned by twi_slave_registers_get, then makes it the front buffer with twi_slave_registers_publish.
+*    The buffers are only swapped between master reads, so all the bytes of a multi-byte read come from the same
+*    snapshot, and no register is copied in the interrupt, which would hold SCL low longer.
+*
+** Input Parameters:
+*  - slave_address: uint8_t
+*    Passes the 7-bit address of the slave, not shifted.
+*  - register_buffer_0: uint8_t*
+*    Passes the first register buffer, holding the initial register values.
+*  - register_buffer_1: uint8_t*
+*    Passes the second register buffer, of the same size.
+*  - register_count: uint8_t
+*    Passes the number of registers in each buffer.
+*  - register_write_callback: void (*)(uint8_t register_address, uint8_t value)
+*    Passes the function called from the TWI interrupt for each register written by the master, or NULL to ignore
+*    the writes, for a read-only register map.
+*
+** Return Value:
+*  - twi_std_error_type_t
+*    The return value returns TWI_E_OK if all the passed configurations are correct, and returns "TWI_E_NOT_OK"
+*    otherwise.
+*
+** Use Example:
+*  static uint8_t status_registers[2][4];
+*  twi_slave_init(0x20, status_registers[0], status_registers[1], 4, NULL);
+*  ...
+*  uint8_t* registers = twi_slave_registers_get();
+*  if (NULL != registers)
+*  {
+*      registers[0] = temperature_high;
+*      registers[1] = temperature_low;
+*      twi_slave_registers_publish();
+*  }
+*********************************************************************************************************************/
+extern twi_std_error_type_t twi_slave_init(uint8_t slave_address, uint8_t* register_buffer_0,
+                                           uint8_t* register_buffer_1, uint8_t register_count,
+                                           void (*register_write_callback)(uint8_t register_address, uint8_t value));
+
+/*********************************************************************************************************************
+** Function Name:
+*  twi_slave_registers_get
+*
+** Description:
+*  This function returns the back register buffer, holding the values of the last published registers, so that the
+*  application can change some of them and publish the buffer again.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - uint8_t*
+*    Returns the back buffer, or NULL if the slave isn't initialized or the last published buffer is still waiting
+*    for a master read to end.
+*********************************************************************************************************************/
+extern uint8_t* twi_slave_registers_get(void);
+
+/*********************************************************************************************************************
+** Function Name:
+*  twi_slave_registers_publish
+*
+** Description:
+*  This function makes the back register buffer the one read by the master. If a master read is in progress, the
+*  buffers are swapped once it ends. The buffer returned by twi_slave_registers_get must not be changed after this
+*  call.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+extern void twi_slave_registers_publish(void);
+
+
+
+#endif /* TWI_ATMEGA32_H_ */
+/*********************************************************************************************************************
+                                               << End of File >>
+*********************************************************************************************************************/
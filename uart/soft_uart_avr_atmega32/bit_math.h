@@ -0,0 +1,51 @@
+/*****************************************************************
+* Author : Alsayed Alsisi
+* Date   : Thursday, November 05, 2020
+* Version: 1.0
+*****************************************************************/
+
+/*****************************************************************
+********************* Header Guard *******************************
+******************************************************************/
+#ifndef BIT_MATH_H_
+#define BIT_MATH_H_
+
+/*****************************************************************
+********************* File Inclusions ****************************
+******************************************************************/
+
+
+/*****************************************************************
+********************* Public Constants ***************************
+******************************************************************/
+
+/*****************************************************************
+********************* Function-Like Macros ***********************
+******************************************************************/
+#define   BIT_SET(VAR, BIT_NUMBER)      (VAR = (VAR | (1<<BIT_NUMBER)))
+#define   BIT_CLEAR(VAR, BIT_NUMBER)    (VAR = (VAR & (~(1<<BIT_NUMBER))))
+#define   BIT_GET(VAR, BIT_NUMBER)      ((VAR>>BIT_NUMBER) & 1)
+#define   BIT_TOGGLE(VAR, BIT_NUMBER)   (VAR = (VAR ^ (1<<BIT_NUMBER)))
+
+/*****************************************************************
+********************* Public Data Types **************************
+******************************************************************/
+
+
+/*****************************************************************
+********************* Public Variable Declarations ***************
+******************************************************************/
+
+
+/*****************************************************************
+********************* Public Function Prototypes *****************
+******************************************************************/
+
+
+
+
+#endif /* BIT_MATH_H_ */
+
+/*****************************************************************
+--------------------- End of File --------------------------------
+******************************************************************/
\ No newline at end of file
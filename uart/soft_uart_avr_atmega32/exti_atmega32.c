@@ -0,0 +1,353 @@
+/*********************************************************************************************************************
+* Author : Alsayed Alsisi
+* Date   : Thursday, May 06, 2021
+* Version: 1.0
+* Contact: alsayed.alsisi@gmail.com
+* License:
+* You have the right to use the file as you wish in any educational or commercial purposes under the following
+* conditions:
+* [1] This file is to be used as is. No modifications are to be made to any part of the file, including this section.
+* [2] This section is not to be removed under any circumstances.
+* [3] Parts of the file may be used separately under the condition they are not modified, and preceded by this section.
+* [4] Any bug encountered in this file or parts of it should be reported to the email address given above to be fixed.
+* [5] No warranty is expressed or implied by the publication or distribution of this source code.
+*********************************************************************************************************************/
+/*********************************************************************************************************************
+* File Information:
+** File Name:
+*  exti_atmega32.c
+*
+** Description:
+*  This file contains the implementation for the device driver of the external interrupts of the atmega32
+*  microcontroller.
+*********************************************************************************************************************/
+
+
+/*********************************************************************************************************************
+                                               << File Inclusions >>
+*********************************************************************************************************************/
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <util/atomic.h>
+#include <stdint.h>
+#include <stddef.h>
+#include "exti_atmega32.h"
+#include "bit_math.h"
+
+/*********************************************************************************************************************
+                                              << Private Constants >>
+*********************************************************************************************************************/
+#define   INITIALIZE_TO_ZERO        (0U)
+#define   EXTI_INTERRUPTS_NUMBER    (3U)
+#define   ISC_BITS_MASK             (0x03U)   /* ISCn1:0 */
+
+/*********************************************************************************************************************
+                                              << Private Data Types >>
+*********************************************************************************************************************/
+
+
+/*********************************************************************************************************************
+                                          << Private Variable Definitions >>
+*********************************************************************************************************************/
+static void (*g_exti_callbacks[EXTI_INTERRUPTS_NUMBER])(void) = {NULL, NULL, NULL};
+
+/* Debouncing: */
+static uint8_t g_exti_debounce_time_ms[EXTI_INTERRUPTS_NUMBER] = {INITIALIZE_TO_ZERO};
+static volatile uint8_t g_exti_debounce_left_ms[EXTI_INTERRUPTS_NUMBER] = {INITIALIZE_TO_ZERO};
+
+/* Enable bits in GICR, and flag bits in GIFR, in the order of exti_interrupt_t: */
+static const uint8_t g_exti_enable_bits[EXTI_INTERRUPTS_NUMBER] = {INT0, INT1, INT2};
+static const uint8_t g_exti_flag_bits[EXTI_INTERRUPTS_NUMBER] = {INTF0, INTF1, INTF2};
+
+/*********************************************************************************************************************
+                                          << Public Variable Definitions >>
+*********************************************************************************************************************/
+
+
+/*********************************************************************************************************************
+                                         << Private Functions Prototypes >>
+*********************************************************************************************************************/
+static inline void exti_event_handle(exti_interrupt_t exti_interrupt);
+
+/*********************************************************************************************************************
+                                          << Public Function Definitions >>
+*********************************************************************************************************************/
+/*********************************************************************************************************************
+** Function Name:
+*  exti_config
+*
+** Description:
+*  This function selects the signal that fires an external interrupt, and the callback that is called from its
+*  interrupt service routine. The interrupt is disabled while the sense is changed, since changing it can set the
+*  interrupt flag, and it's left disabled.
+*
+** Input Parameters:
+*  - exti_interrupt: exti_interrupt_t
+*    Passes the external interrupt.
+*  - exti_sense: exti_sense_t
+*    Passes the level or the edge that fires the interrupt.
+*  - exti_callback: void (*)(void)
+*    Passes the address of the function to be called when the interrupt fires.
+*
+** Return Value:
+*  - exti_std_error_type_t
+*    Returns EXTI_E_OK, or EXTI_E_NOT_OK for a wrong configuration.
+*********************************************************************************************************************/
+exti_std_error_type_t exti_config(exti_interrupt_t exti_interrupt, exti_sense_t exti_sense,
+                                  void (*exti_callback)(void))
+{
+	exti_std_error_type_t return_error = EXTI_E_NOT_OK;
+
+	if ((EXTI_INTERRUPTS_NUMBER > (uint8_t)exti_interrupt) && (EXTI_RISING_EDGE >= exti_sense) &&
+	    (NULL != exti_callback))
+	{
+		(void)exti_disable(exti_interrupt);
+
+		switch (exti_interrupt)
+		{
+			case EXTI_INT0:
+			ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+			{
+				MCUCR = (MCUCR & ~(ISC_BITS_MASK << ISC00)) | ((uint8_t)exti_sense << ISC00);
+			}
+			return_error = EXTI_E_OK;
+			break;
+
+			case EXTI_INT1:
+			ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+			{
+				MCUCR = (MCUCR & ~(ISC_BITS_MASK << ISC10)) | ((uint8_t)exti_sense << ISC10);
+			}
+			return_error = EXTI_E_OK;
+			break;
+
+			case EXTI_INT2:
+			/* INT2 is edge triggered only: */
+			if (EXTI_FALLING_EDGE == exti_sense)
+			{
+				BIT_CLEAR(MCUCSR, ISC2);
+				return_error = EXTI_E_OK;
+			}
+			else if (EXTI_RISING_EDGE == exti_sense)
+			{
+				BIT_SET(MCUCSR, ISC2);
+				return_error = EXTI_E_OK;
+			}
+			else
+			{
+				return_error = EXTI_E_NOT_OK;
+			}
+			break;
+
+			default:
+			return_error = EXTI_E_NOT_OK;
+			break;
+		}
+
+		if (EXTI_E_OK == return_error)
+		{
+			g_exti_callbacks[exti_interrupt] = exti_callback;
+		}
+	}
+	else
+	{
+		return_error = EXTI_E_NOT_OK;
+	}
+
+	return return_error;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  exti_enable
+*
+** Description:
+*  This function clears the flag of an external interrupt, then enables it.
+*
+** Input Parameters:
+*  - exti_interrupt: exti_interrupt_t
+*    Passes the external interrupt.
+*
+** Return Value:
+*  - exti_std_error_type_t
+*    Returns EXTI_E_OK, or EXTI_E_NOT_OK for a wrong interrupt, or an interrupt that wasn't configured.
+*********************************************************************************************************************/
+exti_std_error_type_t exti_enable(exti_interrupt_t exti_interrupt)
+{
+	exti_std_error_type_t return_error = EXTI_E_NOT_OK;
+
+	if ((EXTI_INTERRUPTS_NUMBER > (uint8_t)exti_interrupt) && (NULL != g_exti_callbacks[exti_interrupt]))
+	{
+		g_exti_debounce_left_ms[exti_interrupt] = INITIALIZE_TO_ZERO;
+		/* The flag is cleared by writing one to it: */
+		GIFR = (uint8_t)(1U << g_exti_flag_bits[exti_interrupt]);
+		ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+		{
+			GICR |= (uint8_t)(1U << g_exti_enable_bits[exti_interrupt]);
+		}
+		return_error = EXTI_E_OK;
+	}
+	else
+	{
+		return_error = EXTI_E_NOT_OK;
+	}
+
+	return return_error;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  exti_disable
+*
+** Description:
+*  This function disables an external interrupt, and cancels its debounce time.
+*
+** Input Parameters:
+*  - exti_interrupt: exti_interrupt_t
+*    Passes the external interrupt.
+*
+** Return Value:
+*  - exti_std_error_type_t
+*    Returns EXTI_E_OK, or EXTI_E_NOT_OK for a wrong interrupt.
+*********************************************************************************************************************/
+exti_std_error_type_t exti_disable(exti_interrupt_t exti_interrupt)
+{
+	exti_std_error_type_t return_error = EXTI_E_NOT_OK;
+
+	if (EXTI_INTERRUPTS_NUMBER > (uint8_t)exti_interrupt)
+	{
+		ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+		{
+			GICR &= (uint8_t)(~(1U << g_exti_enable_bits[exti_interrupt]));
+			g_exti_debounce_left_ms[exti_interrupt] = INITIALIZE_TO_ZERO;
+		}
+		return_error = EXTI_E_OK;
+	}
+	else
+	{
+		return_error = EXTI_E_NOT_OK;
+	}
+
+	return return_error;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  exti_debounce_config
+*
+** Description:
+*  This function sets the time, for which an external interrupt is disabled after it fires.
+*
+** Input Parameters:
+*  - exti_interrupt: exti_interrupt_t
+*    Passes the external interrupt.
+*  - debounce_time_ms: uint8_t
+*    Passes the debounce time in milliseconds, or EXTI_DEBOUNCE_DISABLED.
+*
+** Return Value:
+*  - exti_std_error_type_t
+*    Returns EXTI_E_OK, or EXTI_E_NOT_OK for a wrong interrupt.
+*********************************************************************************************************************/
+exti_std_error_type_t exti_debounce_config(exti_interrupt_t exti_interrupt, uint8_t debounce_time_ms)
+{
+	exti_std_error_type_t return_error = EXTI_E_NOT_OK;
+
+	if (EXTI_INTERRUPTS_NUMBER > (uint8_t)exti_interrupt)
+	{
+		g_exti_debounce_time_ms[exti_interrupt] = debounce_time_ms;
+		return_error = EXTI_E_OK;
+	}
+	else
+	{
+		return_error = EXTI_E_NOT_OK;
+	}
+
+	return return_error;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  exti_debounce_tick
+*
+** Description:
+*  This function counts down the debounce time of every external interrupt that is being debounced. Once the time of
+*  an interrupt ends, its flag, which was set by the bounces, is cleared, and the interrupt is enabled again.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+void exti_debounce_tick(void)
+{
+	uint8_t i = INITIALIZE_TO_ZERO;
+
+	for (i = 0; i < EXTI_INTERRUPTS_NUMBER; i++)
+	{
+		ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+		{
+			if (INITIALIZE_TO_ZERO != g_exti_debounce_left_ms[i])
+			{
+				g_exti_debounce_left_ms[i]--;
+				if (INITIALIZE_TO_ZERO == g_exti_debounce_left_ms[i])
+				{
+					GIFR = (uint8_t)(1U << g_exti_flag_bits[i]);
+					GICR |= (uint8_t)(1U << g_exti_enable_bits[i]);
+				}
+			}
+		}
+	}
+}
+
+
+/*********************************************************************************************************************
+                                          << Private Function Definitions >>
+*********************************************************************************************************************/
+/*********************************************************************************************************************
+** Function Name:
+*  exti_event_handle
+*
+** Description:
+*  This function is called by the interrupt service routines. It starts the debounce time of the interrupt, if it's
+*  used, by disabling the interrupt, then calls the callback.
+*
+** Input Parameters:
+*  - exti_interrupt: exti_interrupt_t
+*    Passes the external interrupt that fired.
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+static inline void exti_event_handle(exti_interrupt_t exti_interrupt)
+{
+	if (EXTI_DEBOUNCE_DISABLED != g_exti_debounce_time_ms[exti_interrupt])
+	{
+		GICR &= (uint8_t)(~(1U << g_exti_enable_bits[exti_interrupt]));
+		g_exti_debounce_left_ms[exti_interrupt] = g_exti_debounce_time_ms[exti_interrupt];
+	}
+
+	g_exti_callbacks[exti_interrupt]();
+}
+
+/*********************************************************************************************************************
+Interrupt service routine definitions for the external interrupts.
+*********************************************************************************************************************/
+ISR(INT0_vect)
+{
+	exti_event_handle(EXTI_INT0);
+}
+
+ISR(INT1_vect)
+{
+	exti_event_handle(EXTI_INT1);
+}
+
+ISR(INT2_vect)
+{
+	exti_event_handle(EXTI_INT2);
+}
+
+/*********************************************************************************************************************
+                                                << End of File >>
+*********************************************************************************************************************/
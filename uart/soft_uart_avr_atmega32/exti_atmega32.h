@@ -0,0 +1,196 @@
+/*********************************************************************************************************************
+* Author : Alsayed Alsisi
+* Date   : Thursday, May 06, 2021
+* Version: 1.0
+* Contact: alsayed.alsisi@gmail.com
+* License:
+* You have the right to use the file as you wish in any educational or commercial purposes under the following
+* conditions:
+* [1] This file is to be used as is. No modifications are to be made to any part of the file, including this section.
+* [2] This section is not to be removed under any circumstances.
+* [3] Parts of the file may be used separately under the condition they are not modified, and preceded by this section.
+* [4] Any bug encountered in this file or parts of it should be reported to the email address given above to be fixed.
+* [5] No warranty is expressed or implied by the publication or distribution of this source code.
+*********************************************************************************************************************/
+/*********************************************************************************************************************
+* File Information:
+** File Name:
+*  exti_atmega32.h
+*
+** Description:
+*  This file contains the public programming interfaces for the device driver of the external interrupts (INT0, INT1
+*  and INT2) of the atmega32 microcontroller. Each interrupt calls its own callback on the selected edge or level, so
+*  signals like a CTS line, a start bit, or a wake-up button don't need to be polled.
+*  The interrupt pins are INT0 = PD2, INT1 = PD3, and INT2 = PB2. The driver doesn't change their direction, so they
+*  need to be configured as inputs using the gpio driver, with the pull-up resistor enabled if needed.
+*********************************************************************************************************************/
+
+
+/*********************************************************************************************************************
+                                               << Header Guard >>
+*********************************************************************************************************************/
+#ifndef EXTI_ATMEGA32_H_
+#define EXTI_ATMEGA32_H_
+
+/*********************************************************************************************************************
+                                               << File Inclusions >>
+*********************************************************************************************************************/
+#include <stdint.h>
+
+/*********************************************************************************************************************
+                                               << Public Constants >>
+*********************************************************************************************************************/
+/* Passed to exti_debounce_config to turn the debouncing off: */
+#define   EXTI_DEBOUNCE_DISABLED   (0U)
+
+
+/*********************************************************************************************************************
+                                               << Public Data Types >>
+*********************************************************************************************************************/
+typedef enum
+{
+	EXTI_E_OK = 0,
+	EXTI_E_NOT_OK = 1
+	} exti_std_error_type_t;
+
+typedef enum
+{
+	EXTI_INT0 = 0,
+	EXTI_INT1,
+	EXTI_INT2
+	} exti_interrupt_t;
+
+/* The values of the low level and the edges match the ISCn1:0 bits of INT0 and INT1. INT2 only supports the falling
+   and the rising edges. Only the low level of INT0 and INT1, and the edges of INT2, wake the microcontroller up from
+   the power-down and power-save sleep modes: */
+typedef enum
+{
+	EXTI_LOW_LEVEL = 0,
+	EXTI_ANY_EDGE,
+	EXTI_FALLING_EDGE,
+	EXTI_RISING_EDGE
+	} exti_sense_t;
+
+/*********************************************************************************************************************
+                                           << Public Function Declarations >>
+*********************************************************************************************************************/
+/*********************************************************************************************************************
+** Function Name:
+*  exti_config
+*
+** Description:
+*  This function selects the signal that fires an external interrupt, and the callback that is called from its
+*  interrupt service routine. The interrupt is left disabled, and needs to be enabled using exti_enable.
+*
+** Input Parameters:
+*  - exti_interrupt: exti_interrupt_t
+*    Passes the external interrupt. Example: EXTI_INT0.
+*  - exti_sense: exti_sense_t
+*    Passes the level or the edge that fires the interrupt. Example: EXTI_FALLING_EDGE.
+*  - exti_callback: void (*)(void)
+*    Passes the address of the function to be called when the interrupt fires. It's called from the interrupt
+*    service routine, so it needs to be short.
+*
+** Return Value:
+*  - exti_std_error_type_t
+*    Returns EXTI_E_OK, or EXTI_E_NOT_OK for a wrong interrupt, a wrong sense, a level or any edge on INT2, or a NULL
+*    callback.
+*
+** Use Example:
+*  gpio_pin_config(GPIO_PORTD, GPIO_PIN2, GPIO_INPUT, GPIO_PIN_HIGH);
+*  exti_config(EXTI_INT0, EXTI_FALLING_EDGE, button_pressed);
+*  exti_enable(EXTI_INT0);
+*********************************************************************************************************************/
+extern exti_std_error_type_t exti_config(exti_interrupt_t exti_interrupt, exti_sense_t exti_sense,
+                                         void (*exti_callback)(void));
+
+/*********************************************************************************************************************
+** Function Name:
+*  exti_enable
+*
+** Description:
+*  This function enables an external interrupt. A flag set before enabling it, for example by the edge that the sense
+*  change caused, is cleared first, so only the signals that come after the call fire the interrupt. Note that the
+*  global interrupts need to be enabled as well.
+*
+** Input Parameters:
+*  - exti_interrupt: exti_interrupt_t
+*    Passes the external interrupt. Example: EXTI_INT0.
+*
+** Return Value:
+*  - exti_std_error_type_t
+*    Returns EXTI_E_OK, or EXTI_E_NOT_OK for a wrong interrupt, or an interrupt that wasn't configured using
+*    exti_config.
+*********************************************************************************************************************/
+extern exti_std_error_type_t exti_enable(exti_interrupt_t exti_interrupt);
+
+/*********************************************************************************************************************
+** Function Name:
+*  exti_disable
+*
+** Description:
+*  This function disables an external interrupt, and cancels its debounce time if it's running.
+*
+** Input Parameters:
+*  - exti_interrupt: exti_interrupt_t
+*    Passes the external interrupt. Example: EXTI_INT0.
+*
+** Return Value:
+*  - exti_std_error_type_t
+*    Returns EXTI_E_OK, or EXTI_E_NOT_OK for a wrong interrupt.
+*********************************************************************************************************************/
+extern exti_std_error_type_t exti_disable(exti_interrupt_t exti_interrupt);
+
+/*********************************************************************************************************************
+** Function Name:
+*  exti_debounce_config
+*
+** Description:
+*  This function sets the debounce time of an external interrupt, which is used for mechanical switches. After the
+*  interrupt fires, it's disabled for the debounce time, so the bounces of the contact don't fire it again, then it's
+*  enabled again with its flag cleared. The time is counted by exti_debounce_tick, which needs to be called every
+*  millisecond, usually from a timer interrupt that the application already has. The driver doesn't use a timer of its
+*  own, since all three timers can be used by other drivers.
+*
+** Input Parameters:
+*  - exti_interrupt: exti_interrupt_t
+*    Passes the external interrupt. Example: EXTI_INT0.
+*  - debounce_time_ms: uint8_t
+*    Passes the debounce time in milliseconds, or EXTI_DEBOUNCE_DISABLED.
+*
+** Return Value:
+*  - exti_std_error_type_t
+*    Returns EXTI_E_OK, or EXTI_E_NOT_OK for a wrong interrupt.
+*
+** Use Example:
+*  exti_debounce_config(EXTI_INT0, 20);
+*  ...
+*  ISR(TIMER1_COMPA_vect)   // Every 1 ms
+*  {
+*      exti_debounce_tick();
+*  }
+*********************************************************************************************************************/
+extern exti_std_error_type_t exti_debounce_config(exti_interrupt_t exti_interrupt, uint8_t debounce_time_ms);
+
+/*********************************************************************************************************************
+** Function Name:
+*  exti_debounce_tick
+*
+** Description:
+*  This function counts the debounce time of the external interrupts, and enables each of them again once its time
+*  ends. It needs to be called every millisecond while debouncing is used.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+extern void exti_debounce_tick(void);
+
+
+
+#endif /* EXTI_ATMEGA32_H_ */
+/*********************************************************************************************************************
+                                               << End of File >>
+*********************************************************************************************************************/
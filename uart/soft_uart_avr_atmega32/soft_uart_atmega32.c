@@ -0,0 +1,730 @@
+/*********************************************************************************************************************
+* Author : Alsayed Alsisi
+* Date   : Thursday, May 06, 2021
+* Version: 1.0
+* Contact: alsayed.alsisi@gmail.com
+* License:
+* You have the right to use the file as you wish in any educational or commercial purposes under the following
+* conditions:
+* [1] This file is to be used as is. No modifications are to be made to any part of the file, including this section.
+* [2] This section is not to be removed under any circumstances.
+* [3] Parts of the file may be used separately under the condition they are not modified, and preceded by this section.
+* [4] Any bug encountered in this file or parts of it should be reported to the email address given above to be fixed.
+* [5] No warranty is expressed or implied by the publication or distribution of this source code.
+*********************************************************************************************************************/
+/*********************************************************************************************************************
+* File Information:
+** File Name:
+*  soft_uart_atmega32.c
+*
+** Description:
+*  This file contains the implementation of the software UART of the atmega32 microcontroller.
+*********************************************************************************************************************/
+
+
+/*********************************************************************************************************************
+                                               << File Inclusions >>
+*********************************************************************************************************************/
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <util/atomic.h>
+#include <stdint.h>
+#include <stddef.h>
+#include "soft_uart_atmega32.h"
+#include "gpio_atmega32.h"
+#include "exti_atmega32.h"
+#include "bit_math.h"
+
+/*********************************************************************************************************************
+                                              << Private Constants >>
+*********************************************************************************************************************/
+#define   INITIALIZE_TO_ZERO                (0U)
+#define   SOFT_UART_EXTI_NUMBER             (3U)
+
+/* Transmitted frame: start bit (0), 8 data bits from the LSB, stop bit (1): */
+#define   SOFT_UART_TX_FRAME_BITS           (10U)
+#define   SOFT_UART_TX_STOP_BIT             (1U << 9)
+
+/* Received samples: start bit, 8 data bits, stop bit: */
+#define   SOFT_UART_RX_SAMPLES              (10U)
+#define   SOFT_UART_RX_DATA_MSB             (0x80U)
+
+/* Timer1 clock selection: */
+#define   SOFT_UART_TIMER_TICKS_MAX         (65535UL)
+#define   SOFT_UART_PRESCALER_8             (8UL)
+
+/* Estimated CPU cycles from the start bit edge to the TCNT1 read in the external interrupt, plus from a compare
+   match to the pin read in its interrupt. They're taken off the first sample time, so the samples land in the middle
+   of the bits: */
+#define   SOFT_UART_RX_LATENCY_CYCLES       (110UL)
+
+/*********************************************************************************************************************
+                                              << Private Data Types >>
+*********************************************************************************************************************/
+
+
+/*********************************************************************************************************************
+                                          << Private Variable Definitions >>
+*********************************************************************************************************************/
+/* RX pins of the external interrupts, in the order of exti_interrupt_t: */
+static const gpio_port_t g_soft_uart_rx_ports[SOFT_UART_EXTI_NUMBER] = {GPIO_PORTD, GPIO_PORTD, GPIO_PORTB};
+static const gpio_pin_t g_soft_uart_rx_pins[SOFT_UART_EXTI_NUMBER] = {GPIO_PIN2, GPIO_PIN3, GPIO_PIN2};
+
+/* Pins: */
+static uint8_t g_soft_uart_pins_configured = INITIALIZE_TO_ZERO;
+static gpio_port_t g_soft_uart_tx_port = GPIO_PORTA;
+static gpio_pin_t g_soft_uart_tx_pin = GPIO_PIN0;
+static exti_interrupt_t g_soft_uart_rx_interrupt = EXTI_INT0;
+
+/* Bit timing in Timer1 ticks: */
+static uint16_t g_soft_uart_bit_ticks = INITIALIZE_TO_ZERO;
+static uint16_t g_soft_uart_rx_first_sample_ticks = INITIALIZE_TO_ZERO;   /* From the start bit edge */
+
+/* Transmit ring buffer, filled by soft_uart_data_write and emptied by the compare match A interrupt: */
+static uint8_t* g_soft_uart_tx_buffer = NULL;
+static uint8_t g_soft_uart_tx_buffer_size = INITIALIZE_TO_ZERO;
+static volatile uint8_t g_soft_uart_tx_buffer_head = INITIALIZE_TO_ZERO;   /* Written only by soft_uart_data_write */
+static volatile uint8_t g_soft_uart_tx_buffer_tail = INITIALIZE_TO_ZERO;   /* Written only by the interrupt routine */
+static volatile uint8_t g_soft_uart_tx_enabled = INITIALIZE_TO_ZERO;
+static volatile uint8_t g_soft_uart_tx_active = INITIALIZE_TO_ZERO;        /* Compare match A interrupt running */
+static uint16_t g_soft_uart_tx_frame = INITIALIZE_TO_ZERO;                 /* Bits left to write, LSB first */
+static uint8_t g_soft_uart_tx_bits_left = INITIALIZE_TO_ZERO;
+
+/* Receive ring buffer, filled by the compare match B interrupt: */
+static uint8_t* g_soft_uart_rx_buffer = NULL;
+static uint8_t g_soft_uart_rx_buffer_size = INITIALIZE_TO_ZERO;
+static volatile uint8_t g_soft_uart_rx_buffer_head = INITIALIZE_TO_ZERO;   /* Written only by the interrupt routine */
+static volatile uint8_t g_soft_uart_rx_buffer_tail = INITIALIZE_TO_ZERO;   /* Written only by soft_uart_rx_buffer_read */
+static volatile uint8_t g_soft_uart_rx_enabled = INITIALIZE_TO_ZERO;
+static uint8_t g_soft_uart_rx_data = INITIALIZE_TO_ZERO;
+static uint8_t g_soft_uart_rx_samples_left = INITIALIZE_TO_ZERO;
+
+/*********************************************************************************************************************
+                                          << Public Variable Definitions >>
+*********************************************************************************************************************/
+
+
+/*********************************************************************************************************************
+                                         << Private Functions Prototypes >>
+*********************************************************************************************************************/
+static void soft_uart_start_bit_detect(void);
+static void soft_uart_rx_byte_store(void);
+
+/*********************************************************************************************************************
+                                          << Public Function Definitions >>
+*********************************************************************************************************************/
+/*********************************************************************************************************************
+** Function Name:
+*  soft_uart_pins_config
+*
+** Description:
+*  This function configures the TX pin as an idle high output, and the RX pin as an input with pull-up, whose
+*  external interrupt fires on the falling edge of the start bit.
+*
+** Input Parameters:
+*  - tx_port: gpio_port_t
+*    Passes the port of the TX pin.
+*  - tx_pin: gpio_pin_t
+*    Passes the TX pin.
+*  - rx_interrupt: exti_interrupt_t
+*    Passes the external interrupt of the RX pin.
+*
+** Return Value:
+*  - soft_uart_std_error_type_t
+*    The return value returns SOFT_UART_E_OK if all the passed configurations are correct, and returns
+*    "SOFT_UART_E_NOT_OK" otherwise.
+*********************************************************************************************************************/
+soft_uart_std_error_type_t soft_uart_pins_config(gpio_port_t tx_port, gpio_pin_t tx_pin,
+                                                 exti_interrupt_t rx_interrupt)
+{
+	soft_uart_std_error_type_t return_error = SOFT_UART_E_NOT_OK;
+
+	if ((EXTI_INT2 < rx_interrupt) ||
+	    ((g_soft_uart_rx_ports[rx_interrupt] == tx_port) && (g_soft_uart_rx_pins[rx_interrupt] == tx_pin)))
+	{
+		/* Error: wrong external interrupt, or the same pin for both directions. */
+		return_error = SOFT_UART_E_NOT_OK;
+	}
+	else if (GPIO_E_OK != gpio_pin_config(tx_port, tx_pin, GPIO_OUTPUT, GPIO_PIN_HIGH))
+	{
+		/* Error: wrong TX pin. */
+		return_error = SOFT_UART_E_NOT_OK;
+	}
+	else
+	{
+		soft_uart_transmitter_disable();
+		soft_uart_receiver_disable();
+		(void)gpio_pin_config(g_soft_uart_rx_ports[rx_interrupt], g_soft_uart_rx_pins[rx_interrupt], GPIO_INPUT,
+		                      GPIO_PIN_HIGH);
+		(void)exti_config(rx_interrupt, EXTI_FALLING_EDGE, soft_uart_start_bit_detect);
+
+		g_soft_uart_tx_port = tx_port;
+		g_soft_uart_tx_pin = tx_pin;
+		g_soft_uart_rx_interrupt = rx_interrupt;
+		g_soft_uart_pins_configured = 1U;
+		return_error = SOFT_UART_E_OK;
+	}
+
+	return return_error;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  soft_uart_baud_rate_config
+*
+** Description:
+*  This function calculates the bit time in Timer1 ticks, and starts Timer1 in normal mode with the selected clock.
+*
+** Input Parameters:
+*  - baudrate: uint32_t
+*    This parameter is used to pass the baud rate to the function.
+*  - sys_osc_clock_freq: uint32_t
+*    This parameter is used to pass the microcontroller's clock frequency in HZ to the function.
+*
+** Return Value:
+*  - soft_uart_std_error_type_t
+*    The return value returns SOFT_UART_E_OK if the baud rate can be used, and returns "SOFT_UART_E_NOT_OK" otherwise.
+*********************************************************************************************************************/
+soft_uart_std_error_type_t soft_uart_baud_rate_config(uint32_t baudrate, uint32_t sys_osc_clock_freq)
+{
+	soft_uart_std_error_type_t return_error = SOFT_UART_E_NOT_OK;
+	uint32_t bit_cycles = INITIALIZE_TO_ZERO;
+
+	if ((INITIALIZE_TO_ZERO == baudrate) || (INITIALIZE_TO_ZERO != g_soft_uart_tx_enabled) ||
+	    (INITIALIZE_TO_ZERO != g_soft_uart_rx_enabled))
+	{
+		/* Error: no baud rate, or the timing is in use. */
+		return_error = SOFT_UART_E_NOT_OK;
+	}
+	else
+	{
+		bit_cycles = (sys_osc_clock_freq + (baudrate / 2UL)) / baudrate;
+		if (SOFT_UART_BIT_CYCLES_MIN > bit_cycles)
+		{
+			/* Error: the interrupts can't keep up with the baud rate. */
+			return_error = SOFT_UART_E_NOT_OK;
+		}
+		else if (SOFT_UART_TIMER_TICKS_MAX >= bit_cycles)
+		{
+			g_soft_uart_bit_ticks = (uint16_t)bit_cycles;
+			g_soft_uart_rx_first_sample_ticks = (uint16_t)((bit_cycles / 2UL) - SOFT_UART_RX_LATENCY_CYCLES);
+			TCCR1A = INITIALIZE_TO_ZERO;
+			TCCR1B = (1<<CS10);   /* Normal mode, clk/1 */
+			return_error = SOFT_UART_E_OK;
+		}
+		else if (SOFT_UART_TIMER_TICKS_MAX >= (bit_cycles / SOFT_UART_PRESCALER_8))
+		{
+			g_soft_uart_bit_ticks = (uint16_t)(bit_cycles / SOFT_UART_PRESCALER_8);
+			g_soft_uart_rx_first_sample_ticks = (uint16_t)(((bit_cycles / 2UL) - SOFT_UART_RX_LATENCY_CYCLES) /
+			                                               SOFT_UART_PRESCALER_8);
+			TCCR1A = INITIALIZE_TO_ZERO;
+			TCCR1B = (1<<CS11);   /* Normal mode, clk/8 */
+			return_error = SOFT_UART_E_OK;
+		}
+		else
+		{
+			/* Error: the bit time doesn't fit the 16-bit timer. */
+			return_error = SOFT_UART_E_NOT_OK;
+		}
+	}
+
+	return return_error;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  soft_uart_tx_buffer_config
+*
+** Description:
+*  This function sets the transmit ring buffer, and empties it.
+*
+** Input Parameters:
+*  - tx_buffer: uint8_t*
+*    Passes the address of the array that will be used as the transmit ring buffer.
+*  - tx_buffer_size: uint8_t
+*    Passes the size of the transmit ring buffer array. It needs to be 2 or more.
+*
+** Return Value:
+*  - soft_uart_std_error_type_t
+*    The return value returns SOFT_UART_E_OK if the buffer is valid, and returns "SOFT_UART_E_NOT_OK" otherwise.
+*********************************************************************************************************************/
+soft_uart_std_error_type_t soft_uart_tx_buffer_config(uint8_t* tx_buffer, uint8_t tx_buffer_size)
+{
+	soft_uart_std_error_type_t return_error = SOFT_UART_E_NOT_OK;
+
+	if ((NULL == tx_buffer) || (2U > tx_buffer_size) || (INITIALIZE_TO_ZERO != g_soft_uart_tx_enabled))
+	{
+		/* Error: a ring buffer needs at least one free location besides the stored bytes. */
+		return_error = SOFT_UART_E_NOT_OK;
+	}
+	else
+	{
+		g_soft_uart_tx_buffer = tx_buffer;
+		g_soft_uart_tx_buffer_size = tx_buffer_size;
+		g_soft_uart_tx_buffer_head = INITIALIZE_TO_ZERO;
+		g_soft_uart_tx_buffer_tail = INITIALIZE_TO_ZERO;
+		return_error = SOFT_UART_E_OK;
+	}
+
+	return return_error;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  soft_uart_rx_buffer_config
+*
+** Description:
+*  This function sets the receive ring buffer, and empties it.
+*
+** Input Parameters:
+*  - rx_buffer: uint8_t*
+*    Passes the address of the array that will be used as the receive ring buffer.
+*  - rx_buffer_size: uint8_t
+*    Passes the size of the receive ring buffer array. It needs to be 2 or more.
+*
+** Return Value:
+*  - soft_uart_std_error_type_t
+*    The return value returns SOFT_UART_E_OK if the buffer is valid, and returns "SOFT_UART_E_NOT_OK" otherwise.
+*********************************************************************************************************************/
+soft_uart_std_error_type_t soft_uart_rx_buffer_config(uint8_t* rx_buffer, uint8_t rx_buffer_size)
+{
+	soft_uart_std_error_type_t return_error = SOFT_UART_E_NOT_OK;
+
+	if ((NULL == rx_buffer) || (2U > rx_buffer_size) || (INITIALIZE_TO_ZERO != g_soft_uart_rx_enabled))
+	{
+		/* Error: a ring buffer needs at least one free location besides the stored bytes. */
+		return_error = SOFT_UART_E_NOT_OK;
+	}
+	else
+	{
+		g_soft_uart_rx_buffer = rx_buffer;
+		g_soft_uart_rx_buffer_size = rx_buffer_size;
+		g_soft_uart_rx_buffer_head = INITIALIZE_TO_ZERO;
+		g_soft_uart_rx_buffer_tail = INITIALIZE_TO_ZERO;
+		return_error = SOFT_UART_E_OK;
+	}
+
+	return return_error;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  soft_uart_transmitter_enable
+*
+** Description:
+*  This function enables the transmitter. The compare match A interrupt is only enabled while bytes are transmitted.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - soft_uart_std_error_type_t
+*    The return value returns SOFT_UART_E_OK if the transmitter is enabled, and returns "SOFT_UART_E_NOT_OK"
+*    otherwise.
+*********************************************************************************************************************/
+soft_uart_std_error_type_t soft_uart_transmitter_enable(void)
+{
+	soft_uart_std_error_type_t return_error = SOFT_UART_E_NOT_OK;
+
+	if ((INITIALIZE_TO_ZERO == g_soft_uart_pins_configured) || (INITIALIZE_TO_ZERO == g_soft_uart_bit_ticks) ||
+	    (NULL == g_soft_uart_tx_buffer))
+	{
+		/* Error: not configured. */
+		return_error = SOFT_UART_E_NOT_OK;
+	}
+	else
+	{
+		g_soft_uart_tx_enabled = 1U;
+		return_error = SOFT_UART_E_OK;
+	}
+
+	return return_error;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  soft_uart_transmitter_disable
+*
+** Description:
+*  This function stops the compare match A interrupt, empties the transmit buffer, and sets the TX pin high.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+void soft_uart_transmitter_disable(void)
+{
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		BIT_CLEAR(TIMSK, OCIE1A);
+		g_soft_uart_tx_enabled = INITIALIZE_TO_ZERO;
+		g_soft_uart_tx_active = INITIALIZE_TO_ZERO;
+		g_soft_uart_tx_bits_left = INITIALIZE_TO_ZERO;
+		g_soft_uart_tx_buffer_tail = g_soft_uart_tx_buffer_head;
+	}
+
+	if (INITIALIZE_TO_ZERO != g_soft_uart_pins_configured)
+	{
+		(void)gpio_pin_write(g_soft_uart_tx_port, g_soft_uart_tx_pin, GPIO_PIN_HIGH);
+	}
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  soft_uart_transmitter_is_ready
+*
+** Description:
+*  This function returns whether the transmit buffer can take another byte.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - soft_uart_is_ready_t
+*    Returns "SOFT_UART_READY" if a byte can be written, and "SOFT_UART_NOT_READY" otherwise.
+*********************************************************************************************************************/
+soft_uart_is_ready_t soft_uart_transmitter_is_ready(void)
+{
+	soft_uart_is_ready_t is_ready = SOFT_UART_NOT_READY;
+	uint8_t next_head = INITIALIZE_TO_ZERO;
+
+	if (INITIALIZE_TO_ZERO != g_soft_uart_tx_enabled)
+	{
+		next_head = g_soft_uart_tx_buffer_head + 1U;
+		if (g_soft_uart_tx_buffer_size == next_head)
+		{
+			next_head = INITIALIZE_TO_ZERO;
+		}
+		if (next_head != g_soft_uart_tx_buffer_tail)
+		{
+			is_ready = SOFT_UART_READY;
+		}
+	}
+
+	return is_ready;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  soft_uart_data_write
+*
+** Description:
+*  This function stores a byte in the transmit ring buffer. If the transmitter is idle, the compare match A
+*  interrupt is started one bit time from now, and writes the start bit.
+*
+** Input Parameters:
+*  - data_byte: uint8_t
+*    Passes the byte to be transmitted.
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+void soft_uart_data_write(uint8_t data_byte)
+{
+	uint8_t next_head = INITIALIZE_TO_ZERO;
+
+	if (SOFT_UART_READY == soft_uart_transmitter_is_ready())
+	{
+		next_head = g_soft_uart_tx_buffer_head + 1U;
+		if (g_soft_uart_tx_buffer_size == next_head)
+		{
+			next_head = INITIALIZE_TO_ZERO;
+		}
+		g_soft_uart_tx_buffer[g_soft_uart_tx_buffer_head] = data_byte;
+
+		ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+		{
+			g_soft_uart_tx_buffer_head = next_head;
+			if (INITIALIZE_TO_ZERO == g_soft_uart_tx_active)
+			{
+				g_soft_uart_tx_active = 1U;
+				g_soft_uart_tx_bits_left = INITIALIZE_TO_ZERO;
+				OCR1A = TCNT1 + g_soft_uart_bit_ticks;
+				TIFR = (1<<OCF1A);  /* Clearing a pending compare match by writing one to its flag */
+				BIT_SET(TIMSK, OCIE1A);
+			}
+		}
+	}
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  soft_uart_receiver_enable
+*
+** Description:
+*  This function enables the external interrupt of the RX pin, which starts the reception of each byte.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - soft_uart_std_error_type_t
+*    The return value returns SOFT_UART_E_OK if the receiver is enabled, and returns "SOFT_UART_E_NOT_OK" otherwise.
+*********************************************************************************************************************/
+soft_uart_std_error_type_t soft_uart_receiver_enable(void)
+{
+	soft_uart_std_error_type_t return_error = SOFT_UART_E_NOT_OK;
+
+	if ((INITIALIZE_TO_ZERO == g_soft_uart_pins_configured) || (INITIALIZE_TO_ZERO == g_soft_uart_bit_ticks) ||
+	    (NULL == g_soft_uart_rx_buffer))
+	{
+		/* Error: not configured. */
+		return_error = SOFT_UART_E_NOT_OK;
+	}
+	else
+	{
+		g_soft_uart_rx_enabled = 1U;
+		(void)exti_enable(g_soft_uart_rx_interrupt);
+		return_error = SOFT_UART_E_OK;
+	}
+
+	return return_error;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  soft_uart_receiver_disable
+*
+** Description:
+*  This function disables the external interrupt of the RX pin and the compare match B interrupt.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+void soft_uart_receiver_disable(void)
+{
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		g_soft_uart_rx_enabled = INITIALIZE_TO_ZERO;
+		BIT_CLEAR(TIMSK, OCIE1B);
+		if (INITIALIZE_TO_ZERO != g_soft_uart_pins_configured)
+		{
+			(void)exti_disable(g_soft_uart_rx_interrupt);
+		}
+	}
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  soft_uart_rx_buffer_read
+*
+** Description:
+*  This function reads the oldest byte from the receive ring buffer.
+*
+** Input Parameters:
+*  - data_byte: uint8_t*
+*    This a pointer to read back the received byte in the caller function.
+*
+** Return Value:
+*  - soft_uart_std_error_type_t
+*    The return value returns SOFT_UART_E_OK if a byte was read, and returns "SOFT_UART_E_NOT_OK" if the buffer is
+*    empty.
+*********************************************************************************************************************/
+soft_uart_std_error_type_t soft_uart_rx_buffer_read(uint8_t* data_byte)
+{
+	soft_uart_std_error_type_t return_error = SOFT_UART_E_NOT_OK;
+	uint8_t tail = g_soft_uart_rx_buffer_tail;
+
+	/* Checking if the buffer is not empty: */
+	if (tail != g_soft_uart_rx_buffer_head)
+	{
+		*data_byte = g_soft_uart_rx_buffer[tail];
+		tail++;
+		if (g_soft_uart_rx_buffer_size == tail)
+		{
+			tail = INITIALIZE_TO_ZERO;
+		}
+		/* A single byte store, so the interrupt always sees either the old or the new tail: */
+		g_soft_uart_rx_buffer_tail = tail;
+		return_error = SOFT_UART_E_OK;
+	}
+
+	return return_error;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  soft_uart_rx_buffer_count
+*
+** Description:
+*  This function returns the number of received bytes waiting in the receive ring buffer.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - uint8_t
+*    Returns the number of bytes that can be read from the receive ring buffer.
+*********************************************************************************************************************/
+uint8_t soft_uart_rx_buffer_count(void)
+{
+	uint8_t head = g_soft_uart_rx_buffer_head;
+	uint8_t tail = g_soft_uart_rx_buffer_tail;
+	uint8_t return_value = INITIALIZE_TO_ZERO;
+
+	if (head >= tail)
+	{
+		return_value = head - tail;
+	}
+	else
+	{
+		return_value = (g_soft_uart_rx_buffer_size - tail) + head;
+	}
+
+	return return_value;
+}
+
+
+/*********************************************************************************************************************
+                                          << Private Function Definitions >>
+*********************************************************************************************************************/
+/*********************************************************************************************************************
+** Function Name:
+*  soft_uart_start_bit_detect
+*
+** Description:
+*  This function is the external interrupt callback, called on the falling edge of the start bit. It reads the time
+*  of the edge first, then disables the external interrupt for the rest of the byte, and starts the compare match B
+*  interrupt at the middle of the start bit.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+static void soft_uart_start_bit_detect(void)
+{
+	uint16_t edge_time = TCNT1;
+
+	(void)exti_disable(g_soft_uart_rx_interrupt);
+	g_soft_uart_rx_data = INITIALIZE_TO_ZERO;
+	g_soft_uart_rx_samples_left = SOFT_UART_RX_SAMPLES;
+	OCR1B = edge_time + g_soft_uart_rx_first_sample_ticks;
+	TIFR = (1<<OCF1B);  /* Clearing a pending compare match by writing one to its flag */
+	BIT_SET(TIMSK, OCIE1B);
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  soft_uart_rx_byte_store
+*
+** Description:
+*  This function stores the received byte in the receive ring buffer, or drops it if the buffer is full.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+static void soft_uart_rx_byte_store(void)
+{
+	uint8_t next_head = g_soft_uart_rx_buffer_head + 1U;
+
+	if (g_soft_uart_rx_buffer_size == next_head)
+	{
+		next_head = INITIALIZE_TO_ZERO;
+	}
+	if (next_head != g_soft_uart_rx_buffer_tail)
+	{
+		g_soft_uart_rx_buffer[g_soft_uart_rx_buffer_head] = g_soft_uart_rx_data;
+		g_soft_uart_rx_buffer_head = next_head;
+	}
+}
+
+/*********************************************************************************************************************
+Interrupt service routine definition for the Timer1 compare match A interrupt, which writes one bit of the frame to
+the TX pin every bit time. The next compare time is set from the previous one, so the interrupt latency doesn't add
+up. Once the stop bit has lasted one bit time, the next queued byte is started, or the interrupt is stopped.
+*********************************************************************************************************************/
+ISR(TIMER1_COMPA_vect)
+{
+	uint8_t tail = g_soft_uart_tx_buffer_tail;
+
+	OCR1A += g_soft_uart_bit_ticks;
+
+	if (INITIALIZE_TO_ZERO == g_soft_uart_tx_bits_left)
+	{
+		if (tail != g_soft_uart_tx_buffer_head)
+		{
+			g_soft_uart_tx_frame = ((uint16_t)g_soft_uart_tx_buffer[tail] << 1) | SOFT_UART_TX_STOP_BIT;
+			g_soft_uart_tx_bits_left = SOFT_UART_TX_FRAME_BITS;
+			tail++;
+			if (g_soft_uart_tx_buffer_size == tail)
+			{
+				tail = INITIALIZE_TO_ZERO;
+			}
+			g_soft_uart_tx_buffer_tail = tail;
+		}
+		else
+		{
+			BIT_CLEAR(TIMSK, OCIE1A);
+			g_soft_uart_tx_active = INITIALIZE_TO_ZERO;
+		}
+	}
+
+	if (INITIALIZE_TO_ZERO != g_soft_uart_tx_bits_left)
+	{
+		(void)gpio_pin_write(g_soft_uart_tx_port, g_soft_uart_tx_pin, (gpio_pin_level_t)(g_soft_uart_tx_frame & 1U));
+		g_soft_uart_tx_frame >>= 1;
+		g_soft_uart_tx_bits_left--;
+	}
+}
+
+/*********************************************************************************************************************
+Interrupt service routine definition for the Timer1 compare match B interrupt, which samples the RX pin in the middle
+of each bit. A start bit that isn't low any more in its middle was a glitch, and is ignored. A byte whose stop bit
+isn't high has a framing error, and is dropped. The external interrupt is enabled again in the middle of the stop
+bit, ready for the next start bit.
+*********************************************************************************************************************/
+ISR(TIMER1_COMPB_vect)
+{
+	gpio_pin_level_t rx_level = GPIO_PIN_LOW;
+
+	(void)gpio_pin_read(g_soft_uart_rx_ports[g_soft_uart_rx_interrupt], g_soft_uart_rx_pins[g_soft_uart_rx_interrupt],
+	                    &rx_level);
+	OCR1B += g_soft_uart_bit_ticks;
+	g_soft_uart_rx_samples_left--;
+
+	if (SOFT_UART_RX_SAMPLES - 1U == g_soft_uart_rx_samples_left)
+	{
+		/* Start bit: */
+		if (GPIO_PIN_LOW != rx_level)
+		{
+			g_soft_uart_rx_samples_left = INITIALIZE_TO_ZERO;
+		}
+	}
+	else if (INITIALIZE_TO_ZERO != g_soft_uart_rx_samples_left)
+	{
+		/* Data bits, LSB first: */
+		g_soft_uart_rx_data >>= 1;
+		if (GPIO_PIN_LOW != rx_level)
+		{
+			g_soft_uart_rx_data |= SOFT_UART_RX_DATA_MSB;
+		}
+	}
+	else
+	{
+		/* Stop bit: */
+		if (GPIO_PIN_LOW != rx_level)
+		{
+			soft_uart_rx_byte_store();
+		}
+	}
+
+	if (INITIALIZE_TO_ZERO == g_soft_uart_rx_samples_left)
+	{
+		BIT_CLEAR(TIMSK, OCIE1B);
+		(void)exti_enable(g_soft_uart_rx_interrupt);
+	}
+}
+
+/*********************************************************************************************************************
+                                                << End of File >>
+*********************************************************************************************************************/
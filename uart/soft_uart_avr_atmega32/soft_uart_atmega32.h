@@ -0,0 +1,334 @@
+/*********************************************************************************************************************
+* Author : Alsayed Alsisi
+* Date   : Thursday, May 06, 2021
+* Version: 1.0
+* Contact: alsayed.alsisi@gmail.com
+* License:
+* You have the right to use the file as you wish in any educational or commercial purposes under the following
+* conditions:
+* [1] This file is to be used as is. No modifications are to be made to any part of the file, including this section.
+* [2] This section is not to be removed under any circumstances.
+* [3] Parts of the file may be used separately under the condition they are not modified, and preceded by this section.
+* [4] Any bug encountered in this file or parts of it should be reported to the email address given above to be fixed.
+* [5] No warranty is expressed or implied by the publication or distribution of this source code.
+*********************************************************************************************************************/
+/*********************************************************************************************************************
+* File Information:
+** File Name:
+*  soft_uart_atmega32.h
+*
+** Description:
+*  This file contains the public programming interfaces for a software UART of the atmega32 microcontroller, which
+*  adds a second serial channel next to the USART. The frame format is fixed to 8 data bits, no parity, and 1 stop
+*  bit (8N1), and both directions work at the same time (full duplex).
+*  - Transmitting: the bytes are queued in a ring buffer, and each bit is written to the TX pin, which can be any GPIO
+*    pin, by the Timer1 compare match A interrupt.
+*  - Receiving: the falling edge of the start bit fires an external interrupt, so the RX pin is INT0 (PD2), INT1 (PD3)
+*    or INT2 (PB2). Then the Timer1 compare match B interrupt samples the pin in the middle of each bit, and stores the
+*    received bytes in a ring buffer.
+*  Timer1 runs freely, and its compare match A and B interrupts belong to the driver. TCNT1 and the overflow
+*  interrupt can still be used by the application as a time base, but Timer1 must not be reconfigured.
+*
+** Maximum Baud Rate:
+*  The timing is set by the compare registers, so the interrupt latency doesn't add up from bit to bit, but it moves
+*  each sample. The worst case is a sample delayed by the transmit interrupt, and a start bit detected late for the
+*  same reason. The instruction counts of the interrupt routines, including the gpio driver calls, give about 160 CPU
+*  cycles each, so keeping both delays within 40% of a bit needs a bit time of about 800 CPU cycles:
+*  - 16 MHz: 19200 baud.
+*  - 12 MHz: 14400 baud.
+*  - 8 MHz: 9600 baud.
+*  These are estimates from the instruction counts. They weren't verified in a simulator or on hardware, and other
+*  interrupts, like the ones of the USART, add to the delays. soft_uart_baud_rate_config refuses bit times shorter
+*  than SOFT_UART_BIT_CYCLES_MIN.
+*********************************************************************************************************************/
+
+
+/*********************************************************************************************************************
+                                               << Header Guard >>
+*********************************************************************************************************************/
+#ifndef SOFT_UART_ATMEGA32_H_
+#define SOFT_UART_ATMEGA32_H_
+
+/*********************************************************************************************************************
+                                               << File Inclusions >>
+*********************************************************************************************************************/
+#include <stdint.h>
+#include "gpio_atmega32.h"
+#include "exti_atmega32.h"
+
+/*********************************************************************************************************************
+                                               << Public Constants >>
+*********************************************************************************************************************/
+/* Shortest bit time in CPU cycles, which gives the maximum reliable baud rate (see the file description): */
+#define   SOFT_UART_BIT_CYCLES_MIN          (800UL)
+
+
+/*********************************************************************************************************************
+                                               << Public Data Types >>
+*********************************************************************************************************************/
+typedef enum
+{
+	SOFT_UART_E_OK = 0,
+	SOFT_UART_E_NOT_OK = 1
+	} soft_uart_std_error_type_t;
+
+typedef enum
+{
+	SOFT_UART_NOT_READY = 0,
+	SOFT_UART_READY = 1
+	} soft_uart_is_ready_t;
+
+/*********************************************************************************************************************
+                                           << Public Function Declarations >>
+*********************************************************************************************************************/
+/*********************************************************************************************************************
+** Function Name:
+*  soft_uart_pins_config
+*
+** Description:
+*  This function selects the pins of the software UART. The TX pin is made an output at the idle (high) level, and
+*  the RX pin an input with its pull-up resistor enabled. The external interrupt of the RX pin is configured for the
+*  falling edge, and left disabled until the receiver is enabled.
+*
+** Input Parameters:
+*  - tx_port: gpio_port_t
+*    Passes the port of the TX pin. Example: GPIO_PORTC.
+*  - tx_pin: gpio_pin_t
+*    Passes the TX pin. Example: GPIO_PIN7.
+*  - rx_interrupt: exti_interrupt_t
+*    Passes the external interrupt of the RX pin: EXTI_INT0 (PD2), EXTI_INT1 (PD3), or EXTI_INT2 (PB2).
+*
+** Return Value:
+*  - soft_uart_std_error_type_t
+*    The return value returns SOFT_UART_E_OK if all the passed configurations are correct, and returns
+*    "SOFT_UART_E_NOT_OK" for a wrong pin, or a TX pin that is the RX pin.
+*
+** Use Example:
+*  soft_uart_pins_config(GPIO_PORTC, GPIO_PIN7, EXTI_INT1);
+*********************************************************************************************************************/
+extern soft_uart_std_error_type_t soft_uart_pins_config(gpio_port_t tx_port, gpio_pin_t tx_pin,
+                                                        exti_interrupt_t rx_interrupt);
+
+/*********************************************************************************************************************
+** Function Name:
+*  soft_uart_baud_rate_config
+*
+** Description:
+*  This function starts Timer1 as a free running counter, and calculates the bit time in timer ticks. The timer
+*  clock is the CPU clock, or the CPU clock divided by 8 for the baud rates whose bit time doesn't fit the 16-bit
+*  counter. It needs to be called while the transmitter and the receiver are disabled.
+*
+** Input Parameters:
+*  - baudrate: uint32_t
+*    This parameter is used to pass the baud rate to the function.
+*  - sys_osc_clock_freq: uint32_t
+*    This parameter is used to pass the microcontroller's clock frequency in HZ to the function.
+*
+** Return Value:
+*  - soft_uart_std_error_type_t
+*    The return value returns SOFT_UART_E_OK if the baud rate can be used, and returns "SOFT_UART_E_NOT_OK" if its bit
+*    time is shorter than SOFT_UART_BIT_CYCLES_MIN, or too long for the timer.
+*
+** Use Example:
+*  soft_uart_baud_rate_config(9600, 16000000);
+*********************************************************************************************************************/
+extern soft_uart_std_error_type_t soft_uart_baud_rate_config(uint32_t baudrate, uint32_t sys_osc_clock_freq);
+
+/*********************************************************************************************************************
+** Function Name:
+*  soft_uart_tx_buffer_config
+*
+** Description:
+*  This function sets the transmit ring buffer, where soft_uart_data_write queues the bytes to be transmitted. Note
+*  that one location of the buffer is always kept empty, so the buffer holds up to (tx_buffer_size - 1) bytes. It
+*  needs to be called while the transmitter is disabled.
+*
+** Input Parameters:
+*  - tx_buffer: uint8_t*
+*    Passes the address of the array that will be used as the transmit ring buffer.
+*  - tx_buffer_size: uint8_t
+*    Passes the size of the transmit ring buffer array. It needs to be 2 or more.
+*
+** Return Value:
+*  - soft_uart_std_error_type_t
+*    The return value returns SOFT_UART_E_OK if the buffer is valid, and returns "SOFT_UART_E_NOT_OK" otherwise.
+*
+** Use Example:
+*  static uint8_t soft_uart_tx_data_buffer[32];
+*  soft_uart_tx_buffer_config(soft_uart_tx_data_buffer, sizeof(soft_uart_tx_data_buffer));
+*********************************************************************************************************************/
+extern soft_uart_std_error_type_t soft_uart_tx_buffer_config(uint8_t* tx_buffer, uint8_t tx_buffer_size);
+
+/*********************************************************************************************************************
+** Function Name:
+*  soft_uart_rx_buffer_config
+*
+** Description:
+*  This function sets the receive ring buffer, where the received bytes are stored until they're read using
+*  soft_uart_rx_buffer_read. Note that one location of the buffer is always kept empty, so the buffer holds up to
+*  (rx_buffer_size - 1) bytes, and bytes received while the buffer is full are dropped. It needs to be called while
+*  the receiver is disabled.
+*
+** Input Parameters:
+*  - rx_buffer: uint8_t*
+*    Passes the address of the array that will be used as the receive ring buffer.
+*  - rx_buffer_size: uint8_t
+*    Passes the size of the receive ring buffer array. It needs to be 2 or more.
+*
+** Return Value:
+*  - soft_uart_std_error_type_t
+*    The return value returns SOFT_UART_E_OK if the buffer is valid, and returns "SOFT_UART_E_NOT_OK" otherwise.
+*
+** Use Example:
+*  static uint8_t soft_uart_rx_data_buffer[32];
+*  soft_uart_rx_buffer_config(soft_uart_rx_data_buffer, sizeof(soft_uart_rx_data_buffer));
+*********************************************************************************************************************/
+extern soft_uart_std_error_type_t soft_uart_rx_buffer_config(uint8_t* rx_buffer, uint8_t rx_buffer_size);
+
+/*********************************************************************************************************************
+** Function Name:
+*  soft_uart_transmitter_enable
+*
+** Description:
+*  This function enables the transmitter. The pins, the baud rate, and the transmit buffer need to be configured
+*  first.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - soft_uart_std_error_type_t
+*    The return value returns SOFT_UART_E_OK if the transmitter is enabled, and returns "SOFT_UART_E_NOT_OK" if it
+*    isn't configured yet.
+*********************************************************************************************************************/
+extern soft_uart_std_error_type_t soft_uart_transmitter_enable(void);
+
+/*********************************************************************************************************************
+** Function Name:
+*  soft_uart_transmitter_disable
+*
+** Description:
+*  This function disables the transmitter right away. The byte being transmitted is cut, the queued bytes are
+*  dropped, and the TX pin is left at the idle (high) level.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+extern void soft_uart_transmitter_disable(void);
+
+/*********************************************************************************************************************
+** Function Name:
+*  soft_uart_transmitter_is_ready
+*
+** Description:
+*  This function returns whether the transmit buffer can take another byte.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - soft_uart_is_ready_t
+*    Returns "SOFT_UART_READY" if the transmitter is enabled and its buffer isn't full, and "SOFT_UART_NOT_READY"
+*    otherwise.
+*********************************************************************************************************************/
+extern soft_uart_is_ready_t soft_uart_transmitter_is_ready(void);
+
+/*********************************************************************************************************************
+** Function Name:
+*  soft_uart_data_write
+*
+** Description:
+*  This function queues a byte in the transmit buffer, and starts the transmission if the transmitter is idle. The
+*  byte is dropped if the transmitter isn't ready, so soft_uart_transmitter_is_ready needs to be checked first.
+*
+** Input Parameters:
+*  - data_byte: uint8_t
+*    Passes the byte to be transmitted.
+*
+** Return Value:
+*  - void
+*
+** Use Example:
+*  while (SOFT_UART_NOT_READY == soft_uart_transmitter_is_ready());
+*  soft_uart_data_write('A');
+*********************************************************************************************************************/
+extern void soft_uart_data_write(uint8_t data_byte);
+
+/*********************************************************************************************************************
+** Function Name:
+*  soft_uart_receiver_enable
+*
+** Description:
+*  This function enables the external interrupt of the RX pin, so the next start bit starts a reception. The pins,
+*  the baud rate, and the receive buffer need to be configured first.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - soft_uart_std_error_type_t
+*    The return value returns SOFT_UART_E_OK if the receiver is enabled, and returns "SOFT_UART_E_NOT_OK" if it isn't
+*    configured yet.
+*********************************************************************************************************************/
+extern soft_uart_std_error_type_t soft_uart_receiver_enable(void);
+
+/*********************************************************************************************************************
+** Function Name:
+*  soft_uart_receiver_disable
+*
+** Description:
+*  This function disables the receiver. A byte being received is dropped, while the bytes already in the receive
+*  buffer can still be read.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+extern void soft_uart_receiver_disable(void);
+
+/*********************************************************************************************************************
+** Function Name:
+*  soft_uart_rx_buffer_read
+*
+** Description:
+*  This function reads the oldest byte from the receive ring buffer.
+*
+** Input Parameters:
+*  - data_byte: uint8_t*
+*    This a pointer to read back the received byte in the caller function. If the buffer is empty, the variable won't
+*    be changed by the function.
+*
+** Return Value:
+*  - soft_uart_std_error_type_t
+*    The return value returns SOFT_UART_E_OK if a byte was read, and returns "SOFT_UART_E_NOT_OK" if the buffer is
+*    empty.
+*********************************************************************************************************************/
+extern soft_uart_std_error_type_t soft_uart_rx_buffer_read(uint8_t* data_byte);
+
+/*********************************************************************************************************************
+** Function Name:
+*  soft_uart_rx_buffer_count
+*
+** Description:
+*  This function returns the number of received bytes waiting in the receive ring buffer.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - uint8_t
+*    Returns the number of bytes that can be read from the receive ring buffer.
+*********************************************************************************************************************/
+extern uint8_t soft_uart_rx_buffer_count(void);
+
+
+
+#endif /* SOFT_UART_ATMEGA32_H_ */
+/*********************************************************************************************************************
+                                               << End of File >>
+*********************************************************************************************************************/
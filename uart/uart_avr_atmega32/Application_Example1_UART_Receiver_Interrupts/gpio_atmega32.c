@@ -29,6 +29,8 @@
                                                << File Inclusions >>
 *********************************************************************************************************************/
 #include <stdint.h>
+#include <stddef.h>
+#include <util/atomic.h>
 #include "bit_math.h"
 #include "gpio_atmega32.h"
 
@@ -52,15 +54,31 @@
 #define   PIND_REG    *((volatile uint8_t*)(0x30))
 
 #define   PORT_MAX_PIN_COUNT   8
+/* Number of ports in the registers table: */
+#define   GPIO_PORTS_NUMBER    (sizeof(g_gpio_registers) / sizeof(g_gpio_registers[0]))
 /*********************************************************************************************************************
                                               << Private Data Types >>
 *********************************************************************************************************************/
-
+/* The registers of one port: */
+typedef struct
+{
+	volatile uint8_t* port_reg;
+	volatile uint8_t* ddr_reg;
+	volatile uint8_t* pin_reg;
+}gpio_port_registers_t;
 
 /*********************************************************************************************************************
                                           << Private Variable Definitions >>
 *********************************************************************************************************************/
-
+/* The registers of every port, in the order of gpio_port_t. Supporting a microcontroller with more ports only needs
+ * adding its ports here and in gpio_port_t: */
+static const gpio_port_registers_t g_gpio_registers[] =
+{
+	{&PORTA_REG, &DDRA_REG, &PINA_REG},     /* GPIO_PORTA */
+	{&PORTB_REG, &DDRB_REG, &PINB_REG},     /* GPIO_PORTB */
+	{&PORTC_REG, &DDRC_REG, &PINC_REG},     /* GPIO_PORTC */
+	{&PORTD_REG, &DDRD_REG, &PIND_REG}      /* GPIO_PORTD */
+};
 
 /*********************************************************************************************************************
                                           << Public Variable Definitions >>
@@ -102,43 +120,17 @@ gpio_std_return_error_t gpio_port_config(gpio_port_t gpio_port, gpio_direction_t
 {
 	gpio_std_return_error_t return_error = GPIO_E_NOT_OK;
 
-	switch(gpio_port)
+	if (GPIO_PORTS_NUMBER > (uint8_t)gpio_port)
 	{
-		case GPIO_PORTA:
-		/* Setting the port direction: */
-	    DDRA_REG = gpio_port_direction;      /* Accessing DDRA. */
-    	/* Setting the initial value: */
-	    PORTA_REG = gpio_port_init_value;    /* Accessing PORTA*/
-		return_error = GPIO_E_OK;
-		break;
-		
-		case GPIO_PORTB:
-		/* Setting the port direction: */
-	     DDRB_REG = gpio_port_direction;     /* Accessing DDRB. */
-    	/* Setting the initial value: */
-	    PORTB_REG = gpio_port_init_value;    /* Accessing PORTB*/
-		return_error = GPIO_E_OK;
-		break;
-		
-		case GPIO_PORTC:
 		/* Setting the port direction: */
-	     DDRC_REG = gpio_port_direction;     /* Accessing DDRC. */
-    	/* Setting the initial value: */
-	    PORTC_REG = gpio_port_init_value;    /* Accessing PORTC*/
-		return_error = GPIO_E_OK;
-		break;
-		
-		case GPIO_PORTD:
-		/* Setting the port direction: */
-		DDRD_REG = gpio_port_direction;      /* Accessing DDRD. */
+		*g_gpio_registers[gpio_port].ddr_reg = gpio_port_direction;
 		/* Setting the initial value: */
-		PORTD_REG = gpio_port_init_value;    /* Accessing PORTD*/
+		*g_gpio_registers[gpio_port].port_reg = gpio_port_init_value;
 		return_error = GPIO_E_OK;
-		break;
-		
-		default:
-		return_error = GPIO_E_NOT_OK;
-		break;
+	}
+	else
+	{
+		return_error = GPIO_E_NOT_OK; /* Wrong Port */
 	}
 	
 	return return_error;
@@ -173,44 +165,27 @@ gpio_std_return_error_t gpio_port_config(gpio_port_t gpio_port, gpio_direction_t
 gpio_std_return_error_t gpio_pins_config(gpio_port_t gpio_port, uint8_t gpio_pins, gpio_direction_t gpio_pins_direction, uint8_t gpio_pins_init_value) 
 {
 	gpio_std_return_error_t return_error = GPIO_E_NOT_OK;
+	volatile uint8_t* ddr_reg = NULL;
+	volatile uint8_t* port_reg = NULL;
 
-	switch(gpio_port)
+	if (GPIO_PORTS_NUMBER > (uint8_t)gpio_port)
 	{
-		case GPIO_PORTA:
-		/* Setting the pins direction: */
-		DDRA_REG  = (DDRA_REG & ~gpio_pins)  | (gpio_pins & gpio_pins_direction);     /* Accessing DDRA. */
-		/* Setting the initial value: */
-		PORTA_REG = (PORTA_REG & ~gpio_pins) | (gpio_pins & gpio_pins_init_value);    /* Accessing PORTA*/
-		return_error = GPIO_E_OK;
-		break;
-		
-		case GPIO_PORTB:
-		/* Setting the pins direction: */
-		DDRB_REG  =  (DDRB_REG & ~gpio_pins)  | (gpio_pins & gpio_pins_direction);    /* Accessing DDRA. */
-		/* Setting the initial value: */
-		PORTB_REG =  (PORTB_REG & ~gpio_pins) | (gpio_pins & gpio_pins_init_value);   /* Accessing PORTA*/
-		return_error = GPIO_E_OK;
-		break;
-		
-		case GPIO_PORTC:
-		/* Setting the pins direction: */
-		DDRC_REG  =  (DDRC_REG & ~gpio_pins)  | (gpio_pins & gpio_pins_direction);     /* Accessing DDRA. */
-		/* Setting the initial value: */
-		PORTC_REG =  (PORTC_REG & ~gpio_pins) | (gpio_pins & gpio_pins_init_value);    /* Accessing PORTA*/
-		return_error = GPIO_E_OK;
-		break;
-		
-		case GPIO_PORTD:
-		/* Setting the pins direction: */
-		DDRD_REG  = (DDRD_REG & ~gpio_pins)   | (gpio_pins & gpio_pins_direction);     /* Accessing DDRA. */
-		/* Setting the initial value: */
-		PORTD_REG =  (PORTD_REG & ~gpio_pins) | (gpio_pins & gpio_pins_init_value);    /* Accessing PORTA*/
+		ddr_reg = g_gpio_registers[gpio_port].ddr_reg;
+		port_reg = g_gpio_registers[gpio_port].port_reg;
+		/* Interrupts are disabled during the read-modify-write, so that an interrupt that changes other pins of the
+		 * same port in between isn't overwritten: */
+		ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+		{
+			/* Setting the pins direction: */
+			*ddr_reg  = (*ddr_reg & ~gpio_pins)  | (gpio_pins & gpio_pins_direction);
+			/* Setting the initial value: */
+			*port_reg = (*port_reg & ~gpio_pins) | (gpio_pins & gpio_pins_init_value);
+		}
 		return_error = GPIO_E_OK;
-		break;
-		
-		default:
-		return_error = GPIO_E_NOT_OK;
-		break;
+	}
+	else
+	{
+		return_error = GPIO_E_NOT_OK; /* Wrong Port */
 	}
 	
 	return return_error;
@@ -245,44 +220,25 @@ gpio_std_return_error_t gpio_pins_config(gpio_port_t gpio_port, uint8_t gpio_pin
 gpio_std_return_error_t gpio_pin_config(gpio_port_t gpio_port, gpio_pin_t gpio_pin, gpio_direction_t gpio_pin_direction, gpio_pin_level_t gpio_pin_init_level)
 {
 	gpio_std_return_error_t return_error = GPIO_E_NOT_OK;
+	volatile uint8_t* ddr_reg = NULL;
+	volatile uint8_t* port_reg = NULL;
 
-	switch(gpio_port)
+	if ((GPIO_PORTS_NUMBER > (uint8_t)gpio_port) && (PORT_MAX_PIN_COUNT > gpio_pin))
 	{
-		case GPIO_PORTA:
-		/* Setting the pin's direction: */
-		DDRA_REG  =  ((DDRA_REG  & ~(1<<gpio_pin)) | (gpio_pin_direction & (1<<gpio_pin)));   /* Accessing DDRA */
-		/* Setting the pin's initial value: */
-		PORTA_REG =  ((PORTA_REG & ~(1<<gpio_pin)) | (gpio_pin_init_level << gpio_pin));      /* Accessing PORTA */
-		return_error = GPIO_E_OK;
-		break;
-		
-		case GPIO_PORTB:
-		/* Setting the pin's direction: */
-		DDRB_REG  =  ((DDRB_REG  & ~(1<<gpio_pin)) | (gpio_pin_direction & (1<<gpio_pin)));   /* Accessing DDRA */
-		/* Setting the pin's initial value: */
-		PORTB_REG =  ((PORTB_REG & ~(1<<gpio_pin)) | (gpio_pin_init_level << gpio_pin));      /* Accessing PORTA */
-		return_error = GPIO_E_OK;
-		break;
-		
-		case GPIO_PORTC:
-		/* Setting the pin's direction: */
-		DDRC_REG  =  ((DDRC_REG  & ~(1<<gpio_pin)) | (gpio_pin_direction & (1<<gpio_pin)));   /* Accessing DDRA */
-		/* Setting the pin's initial value: */
-		PORTC_REG =  ((PORTC_REG & ~(1<<gpio_pin)) | (gpio_pin_init_level << gpio_pin));      /* Accessing PORTA */
-		return_error = GPIO_E_OK;
-		break;
-		
-		case GPIO_PORTD:
-		/* Setting the pin's direction: */
-		DDRD_REG  =  ((DDRD_REG  & ~(1<<gpio_pin)) | (gpio_pin_direction & (1<<gpio_pin)));   /* Accessing DDRA */
-		/* Setting the pin's initial value: */
-		PORTD_REG =  ((PORTD_REG & ~(1<<gpio_pin)) | (gpio_pin_init_level << gpio_pin));      /* Accessing PORTA */
+		ddr_reg = g_gpio_registers[gpio_port].ddr_reg;
+		port_reg = g_gpio_registers[gpio_port].port_reg;
+		ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+		{
+			/* Setting the pin's direction: */
+			*ddr_reg  = ((*ddr_reg  & ~(1<<gpio_pin)) | (gpio_pin_direction & (1<<gpio_pin)));
+			/* Setting the pin's initial value: */
+			*port_reg = ((*port_reg & ~(1<<gpio_pin)) | (gpio_pin_init_level << gpio_pin));
+		}
 		return_error = GPIO_E_OK;
-		break;
-		
-		default:
-		return_error = GPIO_E_NOT_OK;
-		break;
+	}
+	else
+	{
+		return_error = GPIO_E_NOT_OK; /* Wrong port or pin */
 	}
 	
 	return return_error;
@@ -312,32 +268,14 @@ gpio_std_return_error_t gpio_port_write(gpio_port_t gpio_port, uint8_t gpio_port
 {
 	gpio_std_return_error_t return_error = GPIO_E_NOT_OK;
 	
-	switch (gpio_port)
+	if (GPIO_PORTS_NUMBER > (uint8_t)gpio_port)
 	{
-		
-		case GPIO_PORTA:
-		PORTA_REG = gpio_port_value;
-		return_error = GPIO_E_OK;
-		break;
-		
-		case GPIO_PORTB:
-		PORTB_REG =  gpio_port_value;
+		*g_gpio_registers[gpio_port].port_reg = gpio_port_value;
 		return_error = GPIO_E_OK;
-		break;
-		
-		case GPIO_PORTC:
-		PORTC_REG =  gpio_port_value;
-		return_error = GPIO_E_OK;
-		break;
-		
-		case GPIO_PORTD:
-		PORTD_REG =  gpio_port_value;
-		return_error = GPIO_E_OK;
-		break;
-		
-		default:
-		return_error = GPIO_E_NOT_OK;
-		break;
+	}
+	else
+	{
+		return_error = GPIO_E_NOT_OK; /* Wrong Port */
 	}
 	
 	return return_error;
@@ -368,33 +306,21 @@ gpio_std_return_error_t gpio_port_write(gpio_port_t gpio_port, uint8_t gpio_port
 *********************************************************************************************************************/
 gpio_std_return_error_t gpio_pins_write(gpio_port_t gpio_port, uint8_t gpio_pins, uint8_t gpio_pins_value)
 {
-    gpio_std_return_error_t return_error = GPIO_E_NOT_OK;
+	gpio_std_return_error_t return_error = GPIO_E_NOT_OK;
+	volatile uint8_t* port_reg = NULL;
 	
-	switch (gpio_port)
+	if (GPIO_PORTS_NUMBER > (uint8_t)gpio_port)
 	{
-		case GPIO_PORTA:
-		PORTA_REG = ((PORTA_REG & ~gpio_pins) | (gpio_pins & gpio_pins_value));
-		return_error = GPIO_E_OK;
-		break;
-		
-		case GPIO_PORTB:
-		PORTB_REG = ((PORTB_REG & ~gpio_pins) | (gpio_pins & gpio_pins_value));
-		return_error = GPIO_E_OK;
-		break;
-		
-		case GPIO_PORTC:
-		PORTC_REG = ((PORTC_REG & ~gpio_pins) | (gpio_pins & gpio_pins_value));
-		return_error = GPIO_E_OK;
-		break;
-		
-		case GPIO_PORTD:
-		PORTD_REG = ((PORTD_REG & ~gpio_pins) | (gpio_pins & gpio_pins_value));
+		port_reg = g_gpio_registers[gpio_port].port_reg;
+		ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+		{
+			*port_reg = ((*port_reg & ~gpio_pins) | (gpio_pins & gpio_pins_value));
+		}
 		return_error = GPIO_E_OK;
-		break;
-		
-		default:
-		return_error = GPIO_E_NOT_OK;
-		break;
+	}
+	else
+	{
+		return_error = GPIO_E_NOT_OK; /* Wrong Port */
 	}
 	
 	return return_error;
@@ -425,45 +351,70 @@ gpio_std_return_error_t gpio_pins_write(gpio_port_t gpio_port, uint8_t gpio_pins
 *    Returns 'GPIO_E_OK' for correct configurations, and 'GPIO_E_NOT_OK' if any of the passed configurations is
 *    wrong.
 *********************************************************************************************************************/
-gpio_std_return_error_t gpio_pin_write(gpio_port_t gpio_port, gpio_pin_t gpio_pin, gpio_pin_level_t gpio_pin_level) //tested
+gpio_std_return_error_t gpio_pin_write(gpio_port_t gpio_port, gpio_pin_t gpio_pin, gpio_pin_level_t gpio_pin_level)
 {
-	  gpio_std_return_error_t return_error = GPIO_E_NOT_OK;
-	  
-	  if((PORT_MAX_PIN_COUNT>gpio_pin) && ((GPIO_PIN_HIGH == gpio_pin_level)||(GPIO_PIN_LOW == gpio_pin_level)))
-	  {
-		  switch (gpio_port)
-		  {
-		    case GPIO_PORTA:
-		    PORTA_REG = ((PORTA_REG & ~(1<<gpio_pin)) | (gpio_pin_level << gpio_pin));
-			return_error = GPIO_E_OK;
-		    break;
-		    
-		    case GPIO_PORTB:
-		    PORTB_REG = ((PORTB_REG & ~(1<<gpio_pin)) | (gpio_pin_level << gpio_pin));
-			return_error = GPIO_E_OK;
-		    break;
-		    
-		    case GPIO_PORTC:
-		    PORTC_REG = ((PORTC_REG & ~(1<<gpio_pin)) | (gpio_pin_level << gpio_pin));
-			return_error = GPIO_E_OK;
-		    break;
-		    
-		    case GPIO_PORTD:
-		    PORTD_REG = ((PORTD_REG & ~(1<<gpio_pin)) | (gpio_pin_level << gpio_pin));
-			return_error = GPIO_E_OK;
-		    break;
-		    
-		    default:
-			return_error = GPIO_E_NOT_OK; /* Wrong Port */
-		    break;
-		  }
-	  }
-	  else
-	  {
-		  return_error = GPIO_E_NOT_OK;  /* Wrong pin or pin level */
-	  }
-	  
-	  return return_error;
+	gpio_std_return_error_t return_error = GPIO_E_NOT_OK;
+	volatile uint8_t* port_reg = NULL;
+	
+	if ((GPIO_PORTS_NUMBER > (uint8_t)gpio_port) && (PORT_MAX_PIN_COUNT > gpio_pin) &&
+	    ((GPIO_PIN_HIGH == gpio_pin_level) || (GPIO_PIN_LOW == gpio_pin_level)))
+	{
+		port_reg = g_gpio_registers[gpio_port].port_reg;
+		ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+		{
+			*port_reg = ((*port_reg & ~(1<<gpio_pin)) | (gpio_pin_level << gpio_pin));
+		}
+		return_error = GPIO_E_OK;
+	}
+	else
+	{
+		return_error = GPIO_E_NOT_OK;  /* Wrong port, pin or pin level */
+	}
+	
+	return return_error;
+}
+
+
+/*********************************************************************************************************************
+** Function Name:
+*  gpio_pin_toggle
+*
+** Description:
+*  The following function is used to invert the output level of a selected pin of a certain port in case the pin is 
+*  configured as output, or to enable/disable its pull-up resistor in case the pin is configured as input. The
+*  ATmega32 doesn't toggle a pin when 1 is written to its PIN register bit, so the PORT register is inverted with
+*  interrupts disabled.
+*
+** Input Parameters:
+*  - gpio_port: gpio_port_t
+*    This parameter is used to pass the certain port to which the pin belongs to the function. Example: GPIO_PORTA.
+*  - gpio_pin: gpio_pin_t
+*    This parameter passes the selected pin to the function. Example: GPIO_PIN3.
+*
+** Return Value:
+*  - gpio_std_return_error_t
+*    Returns 'GPIO_E_OK' for correct port and pin, and 'GPIO_E_NOT_OK' if any of them is wrong.
+*********************************************************************************************************************/
+gpio_std_return_error_t gpio_pin_toggle(gpio_port_t gpio_port, gpio_pin_t gpio_pin)
+{
+	gpio_std_return_error_t return_error = GPIO_E_NOT_OK;
+	volatile uint8_t* port_reg = NULL;
+	
+	if ((GPIO_PORTS_NUMBER > (uint8_t)gpio_port) && (PORT_MAX_PIN_COUNT > gpio_pin))
+	{
+		port_reg = g_gpio_registers[gpio_port].port_reg;
+		ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+		{
+			*port_reg ^= (uint8_t)(1<<gpio_pin);
+		}
+		return_error = GPIO_E_OK;
+	}
+	else
+	{
+		return_error = GPIO_E_NOT_OK;  /* Wrong port or pin */
+	}
+	
+	return return_error;
 }
 
 
@@ -486,33 +437,16 @@ gpio_std_return_error_t gpio_pin_write(gpio_port_t gpio_port, gpio_pin_t gpio_pi
 *********************************************************************************************************************/
 gpio_std_return_error_t gpio_port_read(gpio_port_t gpio_port, uint8_t* gpio_port_value) 
 {
-    gpio_std_return_error_t return_error = GPIO_E_NOT_OK;
+	gpio_std_return_error_t return_error = GPIO_E_NOT_OK;
 	
-	switch (gpio_port)
+	if (GPIO_PORTS_NUMBER > (uint8_t)gpio_port)
 	{
-		case GPIO_PORTA:
-		*gpio_port_value = PINA_REG ;
-		return_error = GPIO_E_OK;
-		break;
-		
-		case GPIO_PORTB:
-		*gpio_port_value = PINB_REG ;
+		*gpio_port_value = *g_gpio_registers[gpio_port].pin_reg;
 		return_error = GPIO_E_OK;
-		break;
-		
-		case GPIO_PORTC:
-		*gpio_port_value = PINC_REG ;
-		return_error = GPIO_E_OK;
-		break;
-		
-		case GPIO_PORTD:
-		*gpio_port_value = PIND_REG ;
-		return_error = GPIO_E_OK;
-		break;
-		
-		default:
+	}
+	else
+	{
 		return_error = GPIO_E_NOT_OK; /* Wrong Port */
-		break;
 	}
 	
 	return return_error;
@@ -539,34 +473,18 @@ gpio_std_return_error_t gpio_port_read(gpio_port_t gpio_port, uint8_t* gpio_port
 *********************************************************************************************************************/
 gpio_std_return_error_t gpio_pins_read(gpio_port_t gpio_port, uint8_t gpio_pins, uint8_t* gpio_pins_value)
 {
-    gpio_std_return_error_t return_error = GPIO_E_NOT_OK;
+	gpio_std_return_error_t return_error = GPIO_E_NOT_OK;
 
-    switch (gpio_port)
-    {
-      case GPIO_PORTA:
-      *gpio_pins_value = (PINA_REG & gpio_pins) ;
-	  return_error = GPIO_E_OK;
-      break;
-      
-      case GPIO_PORTB:
-      *gpio_pins_value = (PINB_REG & gpio_pins) ;
-	  return_error = GPIO_E_OK;
-      break;
-      
-      case GPIO_PORTC:
-      *gpio_pins_value = (PINC_REG & gpio_pins) ;
-	  return_error = GPIO_E_OK;
-      break;
-      
-      case GPIO_PORTD:
-      *gpio_pins_value = (PIND_REG & gpio_pins) ;
-      break;
-      
-      default:
-      return_error = GPIO_E_NOT_OK; /* Wrong Port*/
-      break;
-    }
-    
+	if (GPIO_PORTS_NUMBER > (uint8_t)gpio_port)
+	{
+		*gpio_pins_value = (*g_gpio_registers[gpio_port].pin_reg & gpio_pins);
+		return_error = GPIO_E_OK;
+	}
+	else
+	{
+		return_error = GPIO_E_NOT_OK; /* Wrong Port */
+	}
+	
 	return return_error;
 }
 
@@ -594,39 +512,14 @@ gpio_std_return_error_t gpio_pin_read(gpio_port_t gpio_port, gpio_pin_t gpio_pin
 {
 	gpio_std_return_error_t return_error = GPIO_E_NOT_OK;
 	
-	if(PORT_MAX_PIN_COUNT>gpio_pin)
+	if ((GPIO_PORTS_NUMBER > (uint8_t)gpio_port) && (PORT_MAX_PIN_COUNT > gpio_pin))
 	{
-		
-		switch (gpio_port)
-		{
-			case GPIO_PORTA:
-			*pin_level = (PINA_REG>>gpio_pin) & 0x01;
-			return_error = GPIO_E_OK;
-			break;
-			
-			case GPIO_PORTB:
-			*pin_level = (PINB_REG>>gpio_pin) & 0x01;
-			return_error = GPIO_E_OK;
-			break;
-			
-			case GPIO_PORTC:
-			*pin_level = (PINC_REG>>gpio_pin) & 0x01;
-			return_error = GPIO_E_OK;
-			break;
-			
-			case GPIO_PORTD:
-			*pin_level = (PIND_REG>>gpio_pin) & 0x01;
-			return_error = GPIO_E_OK;
-			break;
-			
-			default:
-			return_error = GPIO_E_NOT_OK; /* Wrong Port*/
-			break;
-		}
+		*pin_level = (*g_gpio_registers[gpio_port].pin_reg >> gpio_pin) & 0x01;
+		return_error = GPIO_E_OK;
 	}
 	else
 	{
-		return_error = GPIO_E_NOT_OK;  /* Wrong pin*/
+		return_error = GPIO_E_NOT_OK;  /* Wrong port or pin */
 	}
 	  
 	return return_error;
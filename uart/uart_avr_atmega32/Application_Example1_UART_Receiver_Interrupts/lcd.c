@@ -29,17 +29,107 @@
 *********************************************************************************************************************/
 #include "lcd_config.h"  /* Note: It also contains the definition of F_CPU required for the delay functions. */
 #include <util/delay.h>
+#include <util/atomic.h>
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <avr/pgmspace.h>
 #include <stdint.h>
+#include <stddef.h>
 
 #include "lcd.h"
 #include "bit_math.h"
 #include "gpio_atmega32.h"
+#include "number_format.h"
 
 /*********************************************************************************************************************
                                               << Private Constants >>
 *********************************************************************************************************************/
 #define   SHIFT_BY_FOUR   (4U)
 
+/******************************************** Asynchronous Engine-relating Macros ***********************************/
+#define   LCD_ENTRY_COMMAND            (0U)     /* The entry is written with RS = 0 */
+#define   LCD_ENTRY_DATA               (1U)     /* The entry is written with RS = 1 */
+#define   LCD_ENTRY_DELAY              (2U)     /* Nothing is written, the value is a delay in milliseconds */
+#define   LCD_ENTRY_NIBBLE             (3U)     /* A single nibble is written with RS = 0, during 4 bit initialization */
+#define   LCD_DELAY_TICK_TIME_US       (1000UL)
+#define   LCD_POWER_ON_DELAY_MS        (15U)
+#define   LCD_SLOW_COMMANDS_LIMIT      (0x04U)  /* Commands below this value (clear and home) take 1.52ms */
+#define   LCD_FAST_EXECUTION_TIME_US   (40UL)   /* Execution time of other commands and data writes */
+#define   LCD_SLOW_EXECUTION_TIME_US   (1640UL)
+
+#define   TIMER2_PRESCALER             (128UL)
+#define   TIMER2_CTC_PRESCALER_128     ((1<<WGM21)|(1<<CS22)|(1<<CS20))
+#define   TIMER2_STOPPED               (0x00)
+/* Converts a time in micro seconds to Timer2 ticks, rounding up so that the LCD is never accessed too early: */
+#define   LCD_TIMER2_TICKS(TIME_US)    ((uint8_t)((((F_CPU/1000000UL)*(TIME_US)) + TIMER2_PRESCALER - 1UL) / TIMER2_PRESCALER))
+
+/******************************************** Size and Cursor-relating Macros ***************************************/
+/* Set DDRAM address commands of the first character of each line: */
+#if (LCD_SIZE == LCD_16x2)
+#define   LCD_COLUMNS           (16U)
+#define   LCD_ROWS              (2U)
+#define   LCD_LINE_ADDRESSES    {0x80, 0xC0}
+#elif (LCD_SIZE == LCD_16x4)
+#define   LCD_COLUMNS           (16U)
+#define   LCD_ROWS              (4U)
+#define   LCD_LINE_ADDRESSES    {0x80, 0xC0, 0x90, 0xD0}
+#elif (LCD_SIZE == LCD_20x2)
+#define   LCD_COLUMNS           (20U)
+#define   LCD_ROWS              (2U)
+#define   LCD_LINE_ADDRESSES    {0x80, 0xC0}
+#elif (LCD_SIZE == LCD_20x4)
+#define   LCD_COLUMNS           (20U)
+#define   LCD_ROWS              (4U)
+#define   LCD_LINE_ADDRESSES    {0x80, 0xC0, 0x94, 0xD4}
+#elif (LCD_SIZE == LCD_40x2)
+#define   LCD_COLUMNS           (40U)
+#define   LCD_ROWS              (2U)
+#define   LCD_LINE_ADDRESSES    {0x80, 0xC0}
+#else
+#error "LCD_SIZE in lcd_config.h isn't one of the available options"
+#endif
+
+#define   LCD_SET_DDRAM_ADDRESS_COMMAND   (0x80U)
+/* Set DDRAM address commands always have bit 7 set, so zero never matches the cursor address: */
+#define   LCD_CURSOR_UNKNOWN              (0x00U)
+/* The DDRAM of each of the two internal lines is 40 characters long (0x00-0x27 and 0x40-0x67), and the address moves
+   to the other line after the last one: */
+#define   LCD_DDRAM_LINE_LENGTH           (0x28U)
+#define   LCD_DDRAM_LINE_OFFSET_MASK      (0x3FU)
+#define   LCD_DDRAM_SECOND_LINE           (0x40U)
+/* Commands that don't move the cursor, and keep the tracked cursor valid: */
+#define   LCD_DISPLAY_CONTROL_COMMAND     (0x08U)
+#define   LCD_DISPLAY_CONTROL_MASK        (0xF8U)
+#define   LCD_FUNCTION_SET_COMMAND        (0x20U)
+#define   LCD_FUNCTION_SET_MASK           (0xE0U)
+
+/******************************************** Custom Glyph-relating Macros ******************************************/
+#define   LCD_CGRAM_SLOTS                 (8U)
+#define   LCD_GLYPH_ROWS                  (8U)
+#define   LCD_SET_CGRAM_ADDRESS_COMMAND   (0x40U)
+/* A CGRAM address command, the glyph rows, and a DDRAM address command to restore the cursor: */
+#define   LCD_GLYPH_UPLOAD_ENTRIES        (LCD_GLYPH_ROWS + 2U)
+
+/******************************************** Framebuffer-relating Macros *******************************************/
+#define   LCD_CELLS_NUMBER          (LCD_COLUMNS * LCD_ROWS)
+#define   LCD_SPACE_CHARACTER       (' ')
+#define   LCD_FIRST_PRINTABLE_CHARACTER   (' ')
+#define   LCD_FB_CELL_BYTE(CELL)    ((CELL) >> 3)
+#define   LCD_FB_CELL_BIT(CELL)     ((CELL) & 0x07U)
+
+/******************************************** Operation Mode-relating Macros ****************************************/
+#if (LCD_MODE == LCD_4BIT_OPERATION)
+/* Only D4-D7 are wired. They're contiguous, so a nibble is written with a single masked port update: */
+#define   LCD_DATA_PINS_MASK              ((uint8_t)(0x0FU << LCD_D4_PIN_NUMBER))
+#define   LCD_LOW_NIBBLE_MASK             (0x0FU)
+#define   LCD_FUNCTION_SET_8BIT_NIBBLE    (0x03U)
+#define   LCD_FUNCTION_SET_4BIT_NIBBLE    (0x02U)
+#elif (LCD_MODE == LCD_8BIT_OPERATION)
+#define   LCD_DATA_PINS_MASK   ((1<<LCD_D0)|(1<<LCD_D1)|(1<<LCD_D2)|(1<<LCD_D3)|(1<<LCD_D4)|(1<<LCD_D5)|(1<<LCD_D6)|(1<<LCD_D7))
+#else
+#error "LCD_MODE in lcd_config.h isn't one of the available options"
+#endif
+
 /*********************************************************************************************************************
                                               << Private Data Types >>
 *********************************************************************************************************************/
@@ -48,6 +138,62 @@
 /*********************************************************************************************************************
                                           << Private Variable Definitions >>
 *********************************************************************************************************************/
+/* Set DDRAM address command of the first character of each line, kept in flash: */
+static const uint8_t g_lcd_line_start_address[LCD_ROWS] PROGMEM = LCD_LINE_ADDRESSES;
+
+/* Set DDRAM address command matching the cursor position once everything written or queued is executed: */
+static uint8_t g_lcd_cursor_address = LCD_CURSOR_UNKNOWN;
+
+/* Asynchronous queue. Entries are added by the application and removed by the Timer2 interrupt: */
+static uint8_t g_lcd_queue_value[LCD_ASYNC_QUEUE_SIZE];
+static uint8_t g_lcd_queue_type[LCD_ASYNC_QUEUE_SIZE];
+static volatile uint8_t g_lcd_queue_head = 0;   /* Written only by the application */
+static volatile uint8_t g_lcd_queue_tail = 0;   /* Written only by the Timer2 interrupt */
+static volatile uint8_t g_lcd_async_busy = 0;   /* Timer2 is running and the queue is being drained */
+
+/* Initialization sequence queued by lcd_async_init(), as {entry type, value} pairs kept in flash: */
+#if (LCD_MODE == LCD_4BIT_OPERATION)
+static const uint8_t g_lcd_async_init_sequence[][2] PROGMEM =
+{
+	{LCD_ENTRY_DELAY,   LCD_POWER_ON_DELAY_MS},
+	{LCD_ENTRY_NIBBLE,  LCD_FUNCTION_SET_8BIT_NIBBLE},
+	{LCD_ENTRY_DELAY,   5U},
+	{LCD_ENTRY_NIBBLE,  LCD_FUNCTION_SET_8BIT_NIBBLE},
+	{LCD_ENTRY_DELAY,   1U},
+	{LCD_ENTRY_NIBBLE,  LCD_FUNCTION_SET_8BIT_NIBBLE},
+	{LCD_ENTRY_DELAY,   1U},
+	{LCD_ENTRY_NIBBLE,  LCD_FUNCTION_SET_4BIT_NIBBLE},
+	{LCD_ENTRY_DELAY,   1U},
+	{LCD_ENTRY_COMMAND, 0x28},  /* 4-bit mode, 2 lines, 5x8 font */
+	{LCD_ENTRY_COMMAND, 0x0E},  /* Display on, cursor on */
+	{LCD_ENTRY_COMMAND, 0x06},  /* No shift and auto increment right */
+	{LCD_ENTRY_COMMAND, 0x01}   /* Clear lcd */
+};
+#else
+static const uint8_t g_lcd_async_init_sequence[][2] PROGMEM =
+{
+	{LCD_ENTRY_DELAY,   LCD_POWER_ON_DELAY_MS},
+	{LCD_ENTRY_COMMAND, 0x38},  /* 8-bit mode, 2 lines, 5x8 font */
+	{LCD_ENTRY_COMMAND, 0x0E},  /* Display on, cursor on */
+	{LCD_ENTRY_COMMAND, 0x06},  /* No shift and auto increment right */
+	{LCD_ENTRY_COMMAND, 0x01}   /* Clear lcd */
+};
+#endif
+#define   LCD_ASYNC_INIT_ENTRIES   (sizeof(g_lcd_async_init_sequence) / sizeof(g_lcd_async_init_sequence[0]))
+
+/* Framebuffer, and a bit for every character to mark it as changed since the last flush: */
+static uint8_t g_lcd_framebuffer[LCD_CELLS_NUMBER];
+static uint8_t g_lcd_fb_dirty_bitmap[(LCD_CELLS_NUMBER + 7U) / 8U];
+
+/* Flash address of the glyph in each CGRAM slot (NULL for an empty slot), and the slots ordered from the most 
+   recently used to the least recently used: */
+static const uint8_t* g_lcd_glyph_bitmap[LCD_CGRAM_SLOTS];
+static uint8_t g_lcd_glyph_lru[LCD_CGRAM_SLOTS] = {0, 1, 2, 3, 4, 5, 6, 7};
+
+/* Console cursor. The column reaches LCD_COLUMNS after writing the last character of a line, and the line wraps when
+   the next character arrives, so that a full line doesn't leave an empty line under it: */
+static uint8_t g_lcd_console_column = 0;
+static uint8_t g_lcd_console_row = 0;
 
 
 /*********************************************************************************************************************
@@ -58,13 +204,25 @@
 /*********************************************************************************************************************
                                          << Private Functions Prototypes >>
 *********************************************************************************************************************/
+#if (LCD_MODE == LCD_4BIT_OPERATION)
 static void lcd_4bit_init(void);
+static void lcd_nibble_write(uint8_t nibble);
+#else
 static void lcd_8bit_init(void);
+#endif
 
-static void lcd_8bit_command_send(lcd_command_t lcd_command);
-static void lcd_4bit_command_send(lcd_command_t lcd_command);
-static void lcd_8bit_character_write(uint8_t data_character);
-static void lcd_4bit_character_write(uint8_t data_character);
+static void lcd_pins_init(void);
+static void lcd_state_reset(void);
+static void lcd_bus_byte_write(uint8_t value, uint8_t entry_type);
+static void lcd_execution_wait(uint8_t value, uint8_t entry_type);
+static lcd_std_error_type_t lcd_async_entry_add(uint8_t value, uint8_t entry_type);
+static void lcd_async_engine_start(void);
+static void lcd_fb_cell_write(uint8_t cell, uint8_t data_character);
+static void lcd_console_new_line(void);
+static void lcd_cursor_track(uint8_t value, uint8_t entry_type);
+#if (LCD_WAIT_MODE == LCD_BUSY_FLAG_POLLING)
+static gpio_pin_level_t lcd_busy_flag_read(void);
+#endif
 /*********************************************************************************************************************
                                           << Public Function Definitions >>
 *********************************************************************************************************************/
@@ -84,18 +242,60 @@ static void lcd_4bit_character_write(uint8_t data_character);
 *********************************************************************************************************************/
 void lcd_init(void)
 {
-
+	lcd_state_reset();
+#if (LCD_MODE == LCD_4BIT_OPERATION)
+	lcd_4bit_init();
+#else
 	lcd_8bit_init();
+#endif
 	lcd_gotoxy(0,0);
-
 }
 
 /*********************************************************************************************************************
 ** Function Name:
-*
+*  lcd_async_init
 *
 ** Description:
+*  This function starts the LCD initialization in the background and returns immediately. The power-on wait and the 
+*  initialization commands are added to the asynchronous queue, and executed by the Timer2 interrupt, so the global
+*  interrupts need to be enabled. Anything written or queued after this function is executed once the initialization
+*  is done.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - lcd_std_error_type_t
+*    Returns 'LCD_OK' if the initialization was queued, and 'LCD_NOT_OK' if the queue doesn't have enough space.
+*********************************************************************************************************************/
+lcd_std_error_type_t lcd_async_init(void)
+{
+	lcd_std_error_type_t return_error = LCD_NOT_OK;
+	uint8_t i = 0;
+	
+	if (LCD_ASYNC_INIT_ENTRIES <= lcd_async_queue_free_get())
+	{
+		lcd_state_reset();
+		lcd_pins_init();
+		for (i = 0; i < LCD_ASYNC_INIT_ENTRIES; i++)
+		{
+			(void)lcd_async_entry_add(pgm_read_byte(&g_lcd_async_init_sequence[i][1]), 
+			                          pgm_read_byte(&g_lcd_async_init_sequence[i][0]));
+		}
+		lcd_async_engine_start();
+		return_error = LCD_OK;
+	}
+	
+	return return_error;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  lcd_gotoxy
 *
+** Description:
+*  This function moves the cursor to the given coordinates. No command is sent if the cursor is already there, for 
+*  example when the LCD auto-increment after the last character write landed on it.
 *
 ** Input Parameters:
 *  - x: uint8_t
@@ -109,9 +309,20 @@ void lcd_init(void)
 *********************************************************************************************************************/
 lcd_std_error_type_t lcd_gotoxy(uint8_t x, uint8_t y)
 {
-	uint8_t first_char_address[]={0x80, 0xC0, 0x90, 0xD0}; /* Fits 16x2 and 16x4 LCDs */
-	lcd_command_send(first_char_address[y]+(x));
-	_delay_us(100);	
+	lcd_std_error_type_t return_error = LCD_NOT_OK;
+	uint8_t address = 0;
+	
+	if ((LCD_COLUMNS > x) && (LCD_ROWS > y))
+	{
+		address = pgm_read_byte(&g_lcd_line_start_address[y]) + x;
+		if (address != g_lcd_cursor_address)
+		{
+			lcd_command_send(address);
+		}
+		return_error = LCD_OK;
+	}
+	
+	return return_error;
 }
 
 /*********************************************************************************************************************
@@ -127,12 +338,20 @@ lcd_std_error_type_t lcd_gotoxy(uint8_t x, uint8_t y)
 *
 ** Return Value:
 *  - lcd_std_error_type_t
-*    Returns 'LCD_OK' for correct command, and 'LCD_NOT_OK' if the passed command isn't any of the available commands.
+*    Returns 'LCD_OK' once the command is executed by the LCD.
 *
 *********************************************************************************************************************/
 lcd_std_error_type_t lcd_command_send(lcd_command_t lcd_command)
 {
-	lcd_8bit_command_send(lcd_command);
+	/* Waiting for the asynchronous queue, so that the LCD isn't accessed by both: */
+	while (LCD_NOT_READY == lcd_async_is_ready())
+	{
+	}
+	lcd_bus_byte_write(lcd_command, LCD_ENTRY_COMMAND);
+	lcd_execution_wait(lcd_command, LCD_ENTRY_COMMAND);
+	lcd_cursor_track(lcd_command, LCD_ENTRY_COMMAND);
+	
+	return LCD_OK;
 }
 
 /*********************************************************************************************************************
@@ -140,10 +359,11 @@ lcd_std_error_type_t lcd_command_send(lcd_command_t lcd_command)
 *  lcd_character_write
 *
 ** Description:
-*  This function 
+*  This function writes a character at the current cursor position, and waits until the LCD executes it.
 *
 ** Input Parameters:
-*  - void
+*  - data_character: uint8_t
+*    Character to write at the current cursor position.
 *
 ** Return Value:
 *  - void
@@ -151,196 +371,1131 @@ lcd_std_error_type_t lcd_command_send(lcd_command_t lcd_command)
 *********************************************************************************************************************/
 void lcd_character_write(uint8_t data_character)
 {
-	/* For 8 bit LCD operation: */
-	lcd_8bit_character_write(data_character);
-
-
+	/* Waiting for the asynchronous queue, so that the LCD isn't accessed by both: */
+	while (LCD_NOT_READY == lcd_async_is_ready())
+	{
+	}
+	lcd_bus_byte_write(data_character, LCD_ENTRY_DATA);
+	lcd_execution_wait(data_character, LCD_ENTRY_DATA);
+	lcd_cursor_track(data_character, LCD_ENTRY_DATA);
 }
 
 
-
 /*********************************************************************************************************************
-                                          << Private Function Definitions >>
+** Function Name:
+*  lcd_async_command_send
+*
+** Description:
+*  This function adds a command to the asynchronous queue.
+*
+** Input Parameters:
+*  - lcd_command: lcd_command_t
+*    Command to send to the LCD.
+*
+** Return Value:
+*  - lcd_std_error_type_t
+*    Returns 'LCD_OK' if the command was queued, and 'LCD_NOT_OK' if the queue is full.
 *********************************************************************************************************************/
+lcd_std_error_type_t lcd_async_command_send(lcd_command_t lcd_command)
+{
+	lcd_std_error_type_t return_error = lcd_async_entry_add(lcd_command, LCD_ENTRY_COMMAND);
+	
+	lcd_async_engine_start();
+	
+	return return_error;
+}
+
 /*********************************************************************************************************************
 ** Function Name:
-*  lcd_4bit_init
+*  lcd_async_character_write
 *
 ** Description:
-*  This function initializes the LCD for the 4 bit operation mode.
+*  This function adds a character to the asynchronous queue.
 *
 ** Input Parameters:
-*  - void
+*  - data_character: uint8_t
+*    Character to write at the current cursor position.
 *
 ** Return Value:
-*  - void
-*    
+*  - lcd_std_error_type_t
+*    Returns 'LCD_OK' if the character was queued, and 'LCD_NOT_OK' if the queue is full.
 *********************************************************************************************************************/
-static void lcd_4bit_init(void)
+lcd_std_error_type_t lcd_async_character_write(uint8_t data_character)
 {
-	_delay_ms(15);
-	gpio_pins_config(LCD_DATA_PORT, (LCD_D7|LCD_D6|LCD_D5|LCD_D4), GPIO_OUTPUT, 0x00);
-	gpio_pins_config(LCD_CNTRL_PORT, (LCD_RS|LCD_RW|LCD_EN), GPIO_OUTPUT, 0x00);
+	lcd_std_error_type_t return_error = lcd_async_entry_add(data_character, LCD_ENTRY_DATA);
+	
+	lcd_async_engine_start();
+	
+	return return_error;
+}
 
-	lcd_command_send(0x33); 
-	_delay_us(100);
-	lcd_command_send(0x32); //for 4-bit mode
-	_delay_us(100);
-	lcd_command_send(0x28); //for 4-bit mode
-	_delay_us(100);
-	lcd_command_send(0x0E); //display on, cursor on.
-	_delay_us(100);
-	lcd_command_send(0x06); //No shift and auto increment right
-	_delay_us(100);
-	lcd_command_send(0x01); //clear lcd
-	_delay_us(1500); /* This is necessary for the LCD to work correctly.*/
+/*********************************************************************************************************************
+** Function Name:
+*  lcd_async_gotoxy
+*
+** Description:
+*  This function adds a cursor move to the asynchronous queue. Nothing is queued if the cursor will already be there 
+*  once the queued entries are executed.
+*
+** Input Parameters:
+*  - x: uint8_t
+*    Passes the desired character column number to the function.
+*  - y: uint8_t
+*    Passes the desired character line number to the function.
+*
+** Return Value:
+*  - lcd_std_error_type_t
+*    Returns 'LCD_OK' if the cursor move was queued or isn't needed, and 'LCD_NOT_OK' if the queue is full or the x 
+*    or y coordinates is wrong.
+*********************************************************************************************************************/
+lcd_std_error_type_t lcd_async_gotoxy(uint8_t x, uint8_t y)
+{
+	lcd_std_error_type_t return_error = LCD_NOT_OK;
+	uint8_t address = 0;
+	
+	if ((LCD_COLUMNS > x) && (LCD_ROWS > y))
+	{
+		address = pgm_read_byte(&g_lcd_line_start_address[y]) + x;
+		return_error = LCD_OK;
+		if (address != g_lcd_cursor_address)
+		{
+			return_error = lcd_async_command_send(address);
+		}
+	}
+	
+	return return_error;
 }
 
 /*********************************************************************************************************************
 ** Function Name:
-*  lcd_8bit_init
+*  lcd_async_print_string
 *
 ** Description:
-*  This function initializes the LCD for the 8 bit operation mode.
+*  This function adds a null-terminated string to the asynchronous queue. Either the whole string is queued or none 
+*  of it.
 *
 ** Input Parameters:
-*  - void
+*  - str: const char*
+*    Passes the string to print at the current cursor position.
 *
 ** Return Value:
+*  - lcd_std_error_type_t
+*    Returns 'LCD_OK' if the string was queued, and 'LCD_NOT_OK' if there isn't enough space in the queue.
+*********************************************************************************************************************/
+lcd_std_error_type_t lcd_async_print_string(const char* str)
+{
+	lcd_std_error_type_t return_error = LCD_NOT_OK;
+	uint8_t i = 0;
+	
+	/* Finding the string length, limited to what the queue can hold: */
+	while ((str[i] != 0) && (i < LCD_ASYNC_QUEUE_SIZE))
+	{
+		i++;
+	}
+	
+	if (i <= lcd_async_queue_free_get())
+	{
+		for (i = 0; str[i] != 0; i++)
+		{
+			(void)lcd_async_entry_add(str[i], LCD_ENTRY_DATA);
+		}
+		lcd_async_engine_start();
+		return_error = LCD_OK;
+	}
+	
+	return return_error;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  lcd_async_queue_free_get
+*
+** Description:
+*  This function returns the number of free locations in the asynchronous queue.
+*
+** Input Parameters:
 *  - void
 *
+** Return Value:
+*  - uint8_t
+*    Returns the number of commands and characters that can be queued.
 *********************************************************************************************************************/
-static void lcd_8bit_init(void)
+uint8_t lcd_async_queue_free_get(void)
 {
-	_delay_ms(15);
-	/* Configuring data pins as output: */
-	gpio_port_config(LCD_DATA_PORT, GPIO_OUTPUT, 0x00);
-	/* Configuring control pins as output: */
-	gpio_pin_config(LCD_CNTRL_PORT, LCD_RS, GPIO_OUTPUT, GPIO_PIN_LOW);
-	gpio_pin_config(LCD_CNTRL_PORT, LCD_RW, GPIO_OUTPUT, GPIO_PIN_LOW);
-	gpio_pin_config(LCD_CNTRL_PORT, LCD_EN, GPIO_OUTPUT, GPIO_PIN_LOW);	
-
-	lcd_command_send(0x38); 
-	_delay_us(100);
-	lcd_command_send(0x0E); //display on, cursor on.
-	_delay_us(100);
-	lcd_command_send(0x06); //No shift and auto increment right
-	_delay_us(100);
-	lcd_command_send(0x01); //clear lcd
-	_delay_us(1500); /* This is necessary for the LCD to work correctly.*/
+	uint8_t head = g_lcd_queue_head;
+	uint8_t tail = g_lcd_queue_tail;
+	uint8_t used = 0;
 	
-
+	if (head >= tail)
+	{
+		used = head - tail;
+	}
+	else
+	{
+		used = (LCD_ASYNC_QUEUE_SIZE - tail) + head;
+	}
+	
+	/* One location is always kept empty to tell a full queue from an empty one: */
+	return (LCD_ASYNC_QUEUE_SIZE - 1U) - used;
 }
-static void lcd_8bit_command_send(lcd_command_t lcd_command)
+
+/*********************************************************************************************************************
+** Function Name:
+*  lcd_async_is_ready
+*
+** Description:
+*  This function returns whether everything in the asynchronous queue has been executed by the LCD.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - lcd_is_ready_t
+*    Returns "LCD_READY" if the queue is drained, and "LCD_NOT_READY" otherwise.
+*********************************************************************************************************************/
+lcd_is_ready_t lcd_async_is_ready(void)
 {
-	/* For 8 bit LCD operation: */
-	gpio_port_write(LCD_DATA_PORT, lcd_command);
-	gpio_pins_write(LCD_CNTRL_PORT, (LCD_RS|LCD_RW), 0x00); /**/
-	gpio_pin_write(LCD_CNTRL_PORT, LCD_EN, GPIO_PIN_HIGH);
-	_delay_us(40);
-	gpio_pin_write(LCD_CNTRL_PORT, LCD_EN, GPIO_PIN_LOW);
-	_delay_us(100);
+	lcd_is_ready_t return_value = LCD_NOT_READY;
+	
+	if (0 == g_lcd_async_busy)
+	{
+		return_value = LCD_READY;
+	}
+	
+	return return_value;
 }
 
-static void lcd_4bit_command_send(lcd_command_t lcd_command)
+/*********************************************************************************************************************
+** Function Name:
+*  lcd_fb_character_write
+*
+** Description:
+*  This function writes a character into the framebuffer. The character is sent to the LCD by the next flush, only if
+*  it's different from what's already displayed.
+*
+** Input Parameters:
+*  - x: uint8_t
+*    Passes the character column number.
+*  - y: uint8_t
+*    Passes the character line number.
+*  - data_character: uint8_t
+*    Passes the character to write.
+*
+** Return Value:
+*  - lcd_std_error_type_t
+*    Returns 'LCD_OK' for correct character coordinates, and 'LCD_NOT_OK' if the x or y coordinates is wrong.
+*********************************************************************************************************************/
+lcd_std_error_type_t lcd_fb_character_write(uint8_t x, uint8_t y, uint8_t data_character)
 {
-	/* Sending the first 4 bits (MSB bits) */
-	gpio_pins_write(LCD_DATA_PORT, (LCD_D7|LCD_D6|LCD_D5|LCD_D4), ((uint32_t)(lcd_command>>SHIFT_BY_FOUR)<<LCD_D4_PIN_NUMBER));
-	gpio_pins_write(LCD_CNTRL_PORT, (LCD_RS|LCD_RW), 0x00);
-	gpio_pin_write(LCD_CNTRL_PORT, LCD_EN, GPIO_PIN_HIGH);	/* Start of a pulse on the Enable pin: */
-	_delay_us(40);
-	gpio_pin_write(LCD_CNTRL_PORT, LCD_EN, GPIO_PIN_LOW);  	/* End of a pulse on the Enable pin: */
+	lcd_std_error_type_t return_error = LCD_NOT_OK;
 	
-	_delay_us(100);
+	if ((LCD_COLUMNS > x) && (LCD_ROWS > y))
+	{
+		lcd_fb_cell_write((y * LCD_COLUMNS) + x, data_character);
+		return_error = LCD_OK;
+	}
 	
-	/* Sending the last 4 bits (LSB bits): */
-	gpio_pins_write(LCD_DATA_PORT, (LCD_D7|LCD_D6|LCD_D5|LCD_D4), ((uint32_t)lcd_command << LCD_D4_PIN_NUMBER));
-	gpio_pin_write(LCD_CNTRL_PORT, LCD_EN, GPIO_PIN_HIGH);	/* Start of a pulse on the Enable pin: */
-	_delay_us(40);
-	gpio_pin_write(LCD_CNTRL_PORT, LCD_EN, GPIO_PIN_LOW);  	/* End of a pulse on the Enable pin: */
+	return return_error;
 }
-static void lcd_8bit_character_write(uint8_t data_character)
+
+/*********************************************************************************************************************
+** Function Name:
+*  lcd_fb_string_write
+*
+** Description:
+*  This function writes a null-terminated string into the framebuffer starting at the given coordinates. The string 
+*  is clipped at the end of the line.
+*
+** Input Parameters:
+*  - x: uint8_t
+*    Passes the column number of the first character.
+*  - y: uint8_t
+*    Passes the line number.
+*  - str: const char*
+*    Passes the string to write.
+*
+** Return Value:
+*  - lcd_std_error_type_t
+*    Returns 'LCD_OK' if the whole string was written, and 'LCD_NOT_OK' if the coordinates are wrong or the string 
+*    was clipped.
+*********************************************************************************************************************/
+lcd_std_error_type_t lcd_fb_string_write(uint8_t x, uint8_t y, const char* str)
 {
-	gpio_port_write(LCD_DATA_PORT, data_character);
-	gpio_pin_write(LCD_CNTRL_PORT, LCD_RS, GPIO_PIN_HIGH);
-	gpio_pin_write(LCD_CNTRL_PORT, LCD_RW, GPIO_PIN_LOW);
-	gpio_pin_write(LCD_CNTRL_PORT, LCD_EN, GPIO_PIN_HIGH);
-	_delay_us(40);
-	gpio_pin_write(LCD_CNTRL_PORT, LCD_EN, GPIO_PIN_LOW);
-	_delay_us(100);
+	lcd_std_error_type_t return_error = LCD_NOT_OK;
+	uint8_t cell = (y * LCD_COLUMNS) + x;
+	
+	if ((LCD_COLUMNS > x) && (LCD_ROWS > y))
+	{
+		while ((*str != 0) && (LCD_COLUMNS > x))
+		{
+			lcd_fb_cell_write(cell, *str);
+			cell++;
+			x++;
+			str++;
+		}
+		
+		if (0 == *str)
+		{
+			return_error = LCD_OK;
+		}
+	}
+	
+	return return_error;
 }
 
-static void lcd_4bit_character_write(uint8_t data_character)
+/*********************************************************************************************************************
+** Function Name:
+*  lcd_fb_number_write
+*
+** Description:
+*  This function writes an unsigned number as decimal text into the framebuffer, right-aligned in the given width. 
+*  Only the digits that changed are sent by the next flush.
+*
+** Input Parameters:
+*  - x: uint8_t
+*    Passes the column number of the first character.
+*  - y: uint8_t
+*    Passes the line number.
+*  - value: uint32_t
+*    Passes the number to write.
+*  - width: uint8_t
+*    Passes the minimum number of characters, up to NUMBER_FORMAT_U32_DIGITS. Pass 0 for no padding.
+*  - padding: char
+*    Passes the padding character, NUMBER_FORMAT_PAD_SPACE or NUMBER_FORMAT_PAD_ZERO.
+*
+** Return Value:
+*  - lcd_std_error_type_t
+*    Returns 'LCD_OK' if the whole number was written, and 'LCD_NOT_OK' if the coordinates or the width are wrong, or
+*    the number was clipped at the end of the line.
+*********************************************************************************************************************/
+lcd_std_error_type_t lcd_fb_number_write(uint8_t x, uint8_t y, uint32_t value, uint8_t width, char padding)
 {
-	/* Sending the first 4 bits (MSB bits) */
-	gpio_pins_write(LCD_DATA_PORT, (LCD_D7|LCD_D6|LCD_D5|LCD_D4), ((uint32_t)(data_character>>SHIFT_BY_FOUR)<<LCD_D4_PIN_NUMBER));
-	gpio_pin_write(LCD_CNTRL_PORT, LCD_RS, GPIO_PIN_HIGH);
-	gpio_pin_write(LCD_CNTRL_PORT, LCD_RW, GPIO_PIN_LOW);
-	gpio_pin_write(LCD_CNTRL_PORT, LCD_EN, GPIO_PIN_HIGH);	/* Start of a pulse on the Enable pin: */
-	_delay_us(40);
-	gpio_pin_write(LCD_CNTRL_PORT, LCD_EN, GPIO_PIN_LOW);  	/* End of a pulse on the Enable pin: */
+	lcd_std_error_type_t return_error = LCD_NOT_OK;
+	char number_text[NUMBER_FORMAT_U32_DIGITS + 1U];
 	
-	_delay_us(100);
+	if (NUMBER_FORMAT_U32_DIGITS >= width)
+	{
+		(void)number_format_u32(value, width, padding, number_text);
+		return_error = lcd_fb_string_write(x, y, number_text);
+	}
 	
-	/* Sending the last 4 bits (LSB bits) */
-	gpio_pins_write(LCD_DATA_PORT, (LCD_D7|LCD_D6|LCD_D5|LCD_D4), ((uint32_t)data_character << LCD_D4_PIN_NUMBER));
-	gpio_pin_write(LCD_CNTRL_PORT, LCD_EN, GPIO_PIN_HIGH);	/* Start of a pulse on the Enable pin: */
-	_delay_us(40);
-	gpio_pin_write(LCD_CNTRL_PORT, LCD_EN, GPIO_PIN_LOW);  	/* End of a pulse on the Enable pin: */
+	return return_error;
 }
-void lcd_print_string(char* str)
+
+/*********************************************************************************************************************
+** Function Name:
+*  lcd_fb_clear
+*
+** Description:
+*  This function fills the framebuffer with spaces. Only the characters that aren't spaces already are sent by the 
+*  next flush.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+void lcd_fb_clear(void)
 {
-	uint8_t i=0;
-	while (str[i]!=0)
+	uint8_t cell = 0;
+	
+	for (cell = 0; cell < LCD_CELLS_NUMBER; cell++)
 	{
-		lcd_character_write(str[i]);
-		i++;
+		lcd_fb_cell_write(cell, LCD_SPACE_CHARACTER);
 	}
 }
 
-void int_to_string(uint32_t int_number, uint8_t number_of_digits, char* string)
+/*********************************************************************************************************************
+** Function Name:
+*  lcd_fb_flush
+*
+** Description:
+*  This function adds the changed characters of the framebuffer to the asynchronous queue and returns immediately. A 
+*  cursor move is queued only when a changed character doesn't follow the previous one, since the LCD increments its
+*  address after every write. If the queue gets full, the remaining characters stay marked as changed for the next 
+*  call.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - lcd_is_ready_t
+*    Returns "LCD_READY" if all the changed characters were queued, and "LCD_NOT_READY" if some are still waiting for 
+*    space in the queue.
+*********************************************************************************************************************/
+lcd_is_ready_t lcd_fb_flush(void)
 {
-	uint8_t digit;
-	for(int8_t i=(number_of_digits-1); i>=0; i--)
+	lcd_is_ready_t return_value = LCD_READY;
+	uint8_t cell_address = 0;
+	uint8_t entries_needed = 0;
+	uint8_t cell = 0;
+	uint8_t row = 0;
+	uint8_t column = 0;
+	
+	for (row = 0; (row < LCD_ROWS) && (LCD_READY == return_value); row++)
 	{
-		digit = int_number%10;
-		int_number = int_number/10;
-		switch(digit)
+		for (column = 0; (column < LCD_COLUMNS) && (LCD_READY == return_value); column++, cell++)
 		{
-			case 0:
-			string[i]='0';
-			break;
-			case 1:
-			string[i]='1';
-			break;
-			case 2:
-			string[i]='2';
-			break;
-			case 3:
-			string[i]='3';
-			break;
-			case 4:
-			string[i]='4';
-			break;
-			case 5:
-			string[i]='5';
-			break;
-			case 6:
-			string[i]='6';
-			break;
-			case 7:
-			string[i]='7';
-			break;
-			case 8:
-			string[i]='8';
-			break;
-			case 9:
-			string[i]='9';
+			if (0 != (g_lcd_fb_dirty_bitmap[LCD_FB_CELL_BYTE(cell)] & (1 << LCD_FB_CELL_BIT(cell))))
+			{
+				cell_address = pgm_read_byte(&g_lcd_line_start_address[row]) + column;
+				entries_needed = (cell_address == g_lcd_cursor_address) ? 1U : 2U;
+				
+				if (entries_needed > lcd_async_queue_free_get())
+				{
+					/* The rest is sent by the next call: */
+					return_value = LCD_NOT_READY;
+				}
+				else
+				{
+					if (2U == entries_needed)
+					{
+						(void)lcd_async_entry_add(cell_address, LCD_ENTRY_COMMAND);
+					}
+					(void)lcd_async_entry_add(g_lcd_framebuffer[cell], LCD_ENTRY_DATA);
+					BIT_CLEAR(g_lcd_fb_dirty_bitmap[LCD_FB_CELL_BYTE(cell)], LCD_FB_CELL_BIT(cell));
+				}
+			}
+		}
+	}
+	
+	lcd_async_engine_start();
+	
+	return return_value;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  lcd_console_character_write
+*
+** Description:
+*  This function writes a character to the console. The following control characters are handled:
+*  '\r' moves to the start of the line, '\n' moves to the start of the next line, and '\b' erases the character 
+*  before the cursor. Other control characters are ignored.
+*
+** Input Parameters:
+*  - data_character: uint8_t
+*    Passes the character to write.
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+void lcd_console_character_write(uint8_t data_character)
+{
+	switch (data_character)
+	{
+		case '\r':
+		g_lcd_console_column = 0;
+		break;
+		
+		case '\n':
+		lcd_console_new_line();
+		break;
+		
+		case '\b':
+		if (0 != g_lcd_console_column)
+		{
+			g_lcd_console_column--;
+			lcd_fb_cell_write((g_lcd_console_row * LCD_COLUMNS) + g_lcd_console_column, LCD_SPACE_CHARACTER);
+		}
+		break;
+		
+		default:
+		if (LCD_FIRST_PRINTABLE_CHARACTER <= data_character)
+		{
+			if (LCD_COLUMNS == g_lcd_console_column)
+			{
+				lcd_console_new_line();
+			}
+			lcd_fb_cell_write((g_lcd_console_row * LCD_COLUMNS) + g_lcd_console_column, data_character);
+			g_lcd_console_column++;
+		}
+		break;
+	}
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  lcd_console_clear
+*
+** Description:
+*  This function clears the framebuffer and moves the console cursor to the first character.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+void lcd_console_clear(void)
+{
+	lcd_fb_clear();
+	g_lcd_console_column = 0;
+	g_lcd_console_row = 0;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  lcd_glyph_define
+*
+** Description:
+*  This function returns the character code of a glyph, uploading the glyph to the least recently used CGRAM slot 
+*  first if it's not already in one. The cursor position is kept when the glyph is uploaded, unless it isn't known,
+*  like after a cursor or display shift command, in which case the cursor is moved to the first character.
+*
+** Input Parameters:
+*  - glyph_P: const uint8_t*
+*    Passes the address in flash (PROGMEM) of the 8 byte glyph bitmap.
+*  - character_code: uint8_t*
+*    This is a pointer to read back the character code to write to display the glyph.
+*
+** Return Value:
+*  - lcd_std_error_type_t
+*    Returns 'LCD_OK' if the glyph is ready to be written, and 'LCD_NOT_OK' if the glyph address is NULL or the queue
+*    can't hold the upload yet.
+*********************************************************************************************************************/
+lcd_std_error_type_t lcd_glyph_define(const uint8_t* glyph_P, uint8_t* character_code)
+{
+	lcd_std_error_type_t return_error = LCD_NOT_OK;
+	uint8_t cursor_address = g_lcd_cursor_address;
+	uint8_t position = 0;
+	uint8_t slot = 0;
+	uint8_t row = 0;
+	
+	if (NULL != glyph_P)
+	{
+		/* Looking for the glyph in the slots: */
+		for (position = 0; position < LCD_CGRAM_SLOTS; position++)
+		{
+			if (glyph_P == g_lcd_glyph_bitmap[g_lcd_glyph_lru[position]])
+			{
+				return_error = LCD_OK;
+				break;
+			}
+		}
+		
+		if ((LCD_NOT_OK == return_error) && (LCD_GLYPH_UPLOAD_ENTRIES <= lcd_async_queue_free_get()))
+		{
+			/* Replacing the least recently used glyph: */
+			position = LCD_CGRAM_SLOTS - 1U;
+			slot = g_lcd_glyph_lru[position];
+			(void)lcd_async_entry_add(LCD_SET_CGRAM_ADDRESS_COMMAND | (slot * LCD_GLYPH_ROWS), LCD_ENTRY_COMMAND);
+			for (row = 0; row < LCD_GLYPH_ROWS; row++)
+			{
+				(void)lcd_async_entry_add(pgm_read_byte(&glyph_P[row]), LCD_ENTRY_DATA);
+			}
+			/* Characters are written to the CGRAM until the next DDRAM address command, which is queued even if the
+			   cursor position isn't known, moving it to the first character then: */
+			if (LCD_CURSOR_UNKNOWN == cursor_address)
+			{
+				cursor_address = LCD_SET_DDRAM_ADDRESS_COMMAND;
+			}
+			(void)lcd_async_entry_add(cursor_address, LCD_ENTRY_COMMAND);
+			lcd_async_engine_start();
+			g_lcd_glyph_bitmap[slot] = glyph_P;
+			return_error = LCD_OK;
+		}
+		
+		if (LCD_OK == return_error)
+		{
+			/* Moving the slot to the front of the order, as the most recently used: */
+			slot = g_lcd_glyph_lru[position];
+			for (; position > 0; position--)
+			{
+				g_lcd_glyph_lru[position] = g_lcd_glyph_lru[position - 1U];
+			}
+			g_lcd_glyph_lru[0] = slot;
+			*character_code = slot;
+		}
+	}
+	
+	return return_error;
+}
+
+/*********************************************************************************************************************
+                                          << Private Function Definitions >>
+*********************************************************************************************************************/
+#if (LCD_MODE == LCD_4BIT_OPERATION)
+/*********************************************************************************************************************
+** Function Name:
+*  lcd_4bit_init
+*
+** Description:
+*  This function initializes the LCD for the 4 bit operation mode. The LCD starts in the 8 bit mode, so the function 
+*  set commands that switch it to the 4 bit mode are written as single nibbles with fixed delays, since the busy flag
+*  can't be read before that.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - void
+*    
+*********************************************************************************************************************/
+static void lcd_4bit_init(void)
+{
+	_delay_ms(LCD_POWER_ON_DELAY_MS);
+	lcd_pins_init();
+
+	/* Initialization by instruction, which works whatever mode the LCD was left in: */
+	lcd_nibble_write(LCD_FUNCTION_SET_8BIT_NIBBLE);
+	_delay_us(4100);
+	lcd_nibble_write(LCD_FUNCTION_SET_8BIT_NIBBLE);
+	_delay_us(100);
+	lcd_nibble_write(LCD_FUNCTION_SET_8BIT_NIBBLE);
+	_delay_us(100);
+	lcd_nibble_write(LCD_FUNCTION_SET_4BIT_NIBBLE);
+	_delay_us(100);
+	
+	/* From here on, every command is written as two nibbles: */
+	lcd_command_send(0x28); //4-bit mode, 2 lines, 5x8 font.
+	lcd_command_send(0x0E); //display on, cursor on.
+	lcd_command_send(0x06); //No shift and auto increment right
+	lcd_command_send(0x01); //clear lcd
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  lcd_nibble_write
+*
+** Description:
+*  This function writes a nibble to D4-D7 with a single masked port update, and pulses the enable pin.
+*
+** Input Parameters:
+*  - nibble: uint8_t
+*    Passes the nibble to write in its 4 least significant bits.
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+static void lcd_nibble_write(uint8_t nibble)
+{
+	gpio_pins_write_fast(LCD_DATA_PORT, LCD_DATA_PINS_MASK, (uint8_t)(nibble << LCD_D4_PIN_NUMBER));
+	gpio_pin_write_fast(LCD_CNTRL_PORT, LCD_EN, GPIO_PIN_HIGH);
+	_delay_us(1);  /* Enable pulse width is 450ns minimum */
+	gpio_pin_write_fast(LCD_CNTRL_PORT, LCD_EN, GPIO_PIN_LOW);
+	_delay_us(1);  /* Enable cycle time is 1000ns minimum */
+}
+
+#else
+/*********************************************************************************************************************
+** Function Name:
+*  lcd_8bit_init
+*
+** Description:
+*  This function initializes the LCD for the 8 bit operation mode.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - void
+*
+*********************************************************************************************************************/
+static void lcd_8bit_init(void)
+{
+	_delay_ms(LCD_POWER_ON_DELAY_MS);
+	lcd_pins_init();
+
+	lcd_command_send(0x38); //8-bit mode, 2 lines, 5x8 font.
+	lcd_command_send(0x0E); //display on, cursor on.
+	lcd_command_send(0x06); //No shift and auto increment right
+	lcd_command_send(0x01); //clear lcd
+}
+#endif
+
+/*********************************************************************************************************************
+** Function Name:
+*  lcd_pins_init
+*
+** Description:
+*  This function configures the data pins and the control pins as outputs, driven low.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+static void lcd_pins_init(void)
+{
+	/* Configuring data pins as output: */
+	gpio_pins_config(LCD_DATA_PORT, LCD_DATA_PINS_MASK, GPIO_OUTPUT, 0x00);
+	/* Configuring control pins as output: */
+	gpio_pin_config(LCD_CNTRL_PORT, LCD_RS, GPIO_OUTPUT, GPIO_PIN_LOW);
+	gpio_pin_config(LCD_CNTRL_PORT, LCD_RW, GPIO_OUTPUT, GPIO_PIN_LOW);
+	gpio_pin_config(LCD_CNTRL_PORT, LCD_EN, GPIO_OUTPUT, GPIO_PIN_LOW);
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  lcd_state_reset
+*
+** Description:
+*  This function resets what the driver knows about the display before it's initialized: the framebuffer matches the
+*  cleared display, the CGRAM slots are empty, and the cursor position is unknown until the clear command.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+static void lcd_state_reset(void)
+{
+	uint8_t i = 0;
+	
+	for (i = 0; i < LCD_CELLS_NUMBER; i++)
+	{
+		g_lcd_framebuffer[i] = LCD_SPACE_CHARACTER;
+	}
+	for (i = 0; i < sizeof(g_lcd_fb_dirty_bitmap); i++)
+	{
+		g_lcd_fb_dirty_bitmap[i] = 0;
+	}
+	for (i = 0; i < LCD_CGRAM_SLOTS; i++)
+	{
+		g_lcd_glyph_bitmap[i] = NULL;
+	}
+	g_lcd_console_column = 0;
+	g_lcd_console_row = 0;
+	g_lcd_cursor_address = LCD_CURSOR_UNKNOWN;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  lcd_bus_byte_write
+*
+** Description:
+*  This function writes one byte to the LCD, as one 8 bit write or two nibbles depending on LCD_MODE, without waiting
+*  for its execution time. The caller waits for the execution time, either by lcd_execution_wait() or by Timer2 in 
+*  the asynchronous engine.
+*
+** Input Parameters:
+*  - value: uint8_t
+*    Passes the command or character to write.
+*  - entry_type: uint8_t
+*    Passes LCD_ENTRY_COMMAND to write a command, or LCD_ENTRY_DATA to write a character.
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+static void lcd_bus_byte_write(uint8_t value, uint8_t entry_type)
+{
+	gpio_pin_write_fast(LCD_CNTRL_PORT, LCD_RS, (LCD_ENTRY_DATA == entry_type) ? GPIO_PIN_HIGH : GPIO_PIN_LOW);
+	gpio_pin_write_fast(LCD_CNTRL_PORT, LCD_RW, GPIO_PIN_LOW);
+#if (LCD_MODE == LCD_4BIT_OPERATION)
+	/* RS stays the same for both nibbles: */
+	lcd_nibble_write(value >> SHIFT_BY_FOUR);
+	lcd_nibble_write(value & LCD_LOW_NIBBLE_MASK);
+#else
+	gpio_port_write_fast(LCD_DATA_PORT, value);
+	gpio_pin_write_fast(LCD_CNTRL_PORT, LCD_EN, GPIO_PIN_HIGH);
+	_delay_us(1);  /* Enable pulse width is 450ns minimum */
+	gpio_pin_write_fast(LCD_CNTRL_PORT, LCD_EN, GPIO_PIN_LOW);
+#endif
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  lcd_execution_wait
+*
+** Description:
+*  This function waits until the LCD has executed the byte written last, by polling the busy flag or by waiting for 
+*  the worst-case execution time, depending on LCD_WAIT_MODE.
+*
+** Input Parameters:
+*  - value: uint8_t
+*    Passes the command or character written last.
+*  - entry_type: uint8_t
+*    Passes LCD_ENTRY_COMMAND if a command was written, or LCD_ENTRY_DATA if a character was written.
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+static void lcd_execution_wait(uint8_t value, uint8_t entry_type)
+{
+#if (LCD_WAIT_MODE == LCD_BUSY_FLAG_POLLING)
+	(void)value;
+	(void)entry_type;
+	while (GPIO_PIN_HIGH == lcd_busy_flag_read())
+	{
+	}
+#else
+	if ((LCD_ENTRY_COMMAND == entry_type) && (LCD_SLOW_COMMANDS_LIMIT > value))
+	{
+		_delay_us(LCD_SLOW_EXECUTION_TIME_US);
+	}
+	else
+	{
+		_delay_us(LCD_FAST_EXECUTION_TIME_US);
+	}
+#endif
+}
+
+#if (LCD_WAIT_MODE == LCD_BUSY_FLAG_POLLING)
+/*********************************************************************************************************************
+** Function Name:
+*  lcd_busy_flag_read
+*
+** Description:
+*  This function reads the LCD busy flag once. The data pins are switched to input while the LCD drives them, and 
+*  switched back to output before returning. In the 4 bit mode, the busy flag is in the first nibble, and the second
+*  nibble still has to be clocked out.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - gpio_pin_level_t
+*    Returns GPIO_PIN_HIGH if the LCD is still executing the previous command, and GPIO_PIN_LOW if it's ready.
+*********************************************************************************************************************/
+static gpio_pin_level_t lcd_busy_flag_read(void)
+{
+	gpio_pin_level_t busy_flag = GPIO_PIN_HIGH;
+	
+	/* The LCD drives the data pins while RW is high, so they mustn't be driven by the microcontroller: */
+	gpio_pins_direction_set_fast(LCD_DATA_PORT, LCD_DATA_PINS_MASK, GPIO_INPUT);
+	gpio_pins_write_fast(LCD_DATA_PORT, LCD_DATA_PINS_MASK, 0x00);  /* No pull-ups */
+	gpio_pin_write_fast(LCD_CNTRL_PORT, LCD_RS, GPIO_PIN_LOW);
+	gpio_pin_write_fast(LCD_CNTRL_PORT, LCD_RW, GPIO_PIN_HIGH);
+	
+	gpio_pin_write_fast(LCD_CNTRL_PORT, LCD_EN, GPIO_PIN_HIGH);
+	_delay_us(1);  /* Data delay time is 360ns maximum */
+	busy_flag = gpio_pin_read_fast(LCD_DATA_PORT, LCD_D7);
+	gpio_pin_write_fast(LCD_CNTRL_PORT, LCD_EN, GPIO_PIN_LOW);
+#if (LCD_MODE == LCD_4BIT_OPERATION)
+	_delay_us(1);  /* Enable cycle time is 1000ns minimum */
+	gpio_pin_write_fast(LCD_CNTRL_PORT, LCD_EN, GPIO_PIN_HIGH);
+	_delay_us(1);
+	gpio_pin_write_fast(LCD_CNTRL_PORT, LCD_EN, GPIO_PIN_LOW);
+#endif
+	
+	gpio_pin_write_fast(LCD_CNTRL_PORT, LCD_RW, GPIO_PIN_LOW);
+	gpio_pins_direction_set_fast(LCD_DATA_PORT, LCD_DATA_PINS_MASK, GPIO_OUTPUT);
+	
+	return busy_flag;
+}
+#endif
+
+/*********************************************************************************************************************
+** Function Name:
+*  lcd_async_entry_add
+*
+** Description:
+*  This function adds an entry to the asynchronous queue without starting the engine.
+*
+** Input Parameters:
+*  - value: uint8_t
+*    Passes the command or character to queue.
+*  - entry_type: uint8_t
+*    Passes LCD_ENTRY_COMMAND for a command, or LCD_ENTRY_DATA for a character.
+*
+** Return Value:
+*  - lcd_std_error_type_t
+*    Returns 'LCD_OK' if the entry was queued, and 'LCD_NOT_OK' if the queue is full.
+*********************************************************************************************************************/
+static lcd_std_error_type_t lcd_async_entry_add(uint8_t value, uint8_t entry_type)
+{
+	lcd_std_error_type_t return_error = LCD_NOT_OK;
+	uint8_t head = g_lcd_queue_head;
+	uint8_t next_head = head + 1U;
+	
+	if (LCD_ASYNC_QUEUE_SIZE == next_head)
+	{
+		next_head = 0;
+	}
+	
+	/* Checking if the queue is not full: */
+	if (next_head != g_lcd_queue_tail)
+	{
+		g_lcd_queue_value[head] = value;
+		g_lcd_queue_type[head] = entry_type;
+		g_lcd_queue_head = next_head;
+		lcd_cursor_track(value, entry_type);
+		return_error = LCD_OK;
+	}
+	
+	return return_error;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  lcd_async_engine_start
+*
+** Description:
+*  This function starts Timer2 to drain the asynchronous queue, if it's not running already. The first entry is 
+*  written on the next timer tick.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+static void lcd_async_engine_start(void)
+{
+	/* The interrupt stops the engine when the queue becomes empty, so the check and the start can't be separated: */
+	ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+	{
+		if ((0 == g_lcd_async_busy) && (g_lcd_queue_head != g_lcd_queue_tail))
+		{
+			g_lcd_async_busy = 1;
+			TCNT2 = 0;
+			OCR2 = 0;
+			TIFR = (1<<OCF2);  /* Clearing a pending compare match by writing one to its flag */
+			BIT_SET(TIMSK, OCIE2);
+			TCCR2 = TIMER2_CTC_PRESCALER_128;
+		}
+	}
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  lcd_fb_cell_write
+*
+** Description:
+*  This function writes a character into a framebuffer location and marks it as changed, if it's different from the 
+*  character already there.
+*
+** Input Parameters:
+*  - cell: uint8_t
+*    Passes the framebuffer location, which is (line * LCD_COLUMNS) + column.
+*  - data_character: uint8_t
+*    Passes the character to write.
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+static void lcd_fb_cell_write(uint8_t cell, uint8_t data_character)
+{
+	if (g_lcd_framebuffer[cell] != data_character)
+	{
+		g_lcd_framebuffer[cell] = data_character;
+		BIT_SET(g_lcd_fb_dirty_bitmap[LCD_FB_CELL_BYTE(cell)], LCD_FB_CELL_BIT(cell));
+	}
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  lcd_console_new_line
+*
+** Description:
+*  This function moves the console cursor to the start of the next line. On the last line, the framebuffer is 
+*  scrolled up by one line and the last line is cleared instead. Since the framebuffer only marks the characters that
+*  change, the flush after a scroll sends only the characters that differ from the line above them.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+static void lcd_console_new_line(void)
+{
+	uint8_t cell = 0;
+	
+	g_lcd_console_column = 0;
+	
+	if ((LCD_ROWS - 1U) > g_lcd_console_row)
+	{
+		g_lcd_console_row++;
+	}
+	else
+	{
+		for (cell = 0; cell < (LCD_CELLS_NUMBER - LCD_COLUMNS); cell++)
+		{
+			lcd_fb_cell_write(cell, g_lcd_framebuffer[cell + LCD_COLUMNS]);
+		}
+		for (; cell < LCD_CELLS_NUMBER; cell++)
+		{
+			lcd_fb_cell_write(cell, LCD_SPACE_CHARACTER);
+		}
+	}
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  lcd_cursor_track
+*
+** Description:
+*  This function updates the tracked cursor address after a command or a character is written or queued. A character
+*  write moves the cursor to the next DDRAM address, the same way the LCD does in the increment entry mode set by 
+*  lcd_init(). Commands that may move the cursor in other ways make it unknown, until the next cursor move.
+*
+** Input Parameters:
+*  - value: uint8_t
+*    Passes the command or character written.
+*  - entry_type: uint8_t
+*    Passes LCD_ENTRY_COMMAND if a command was written, or LCD_ENTRY_DATA if a character was written.
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+static void lcd_cursor_track(uint8_t value, uint8_t entry_type)
+{
+	uint8_t address = g_lcd_cursor_address;
+	
+	if (LCD_ENTRY_COMMAND < entry_type)
+	{
+		/* Delays don't move the cursor, and nibbles are only written before the clear command */
+	}
+	else if (LCD_ENTRY_DATA == entry_type)
+	{
+		if (LCD_CURSOR_UNKNOWN != address)
+		{
+			address++;
+			if (LCD_DDRAM_LINE_LENGTH == (address & LCD_DDRAM_LINE_OFFSET_MASK))
+			{
+				/* Moving to the start of the other internal line: */
+				address = LCD_SET_DDRAM_ADDRESS_COMMAND | ((address & LCD_DDRAM_SECOND_LINE) ^ LCD_DDRAM_SECOND_LINE);
+			}
+		}
+	}
+	else if (0 != (value & LCD_SET_DDRAM_ADDRESS_COMMAND))
+	{
+		address = value;
+	}
+	else if (LCD_SLOW_COMMANDS_LIMIT > value)
+	{
+		/* Clear display and return home move the cursor to the first character: */
+		address = LCD_SET_DDRAM_ADDRESS_COMMAND;
+	}
+	else if ((LCD_DISPLAY_CONTROL_COMMAND != (value & LCD_DISPLAY_CONTROL_MASK)) &&
+	         (LCD_FUNCTION_SET_COMMAND != (value & LCD_FUNCTION_SET_MASK)))
+	{
+		address = LCD_CURSOR_UNKNOWN;
+	}
+	else
+	{
+		/* The cursor isn't moved by display control and function set commands */
+	}
+	
+	g_lcd_cursor_address = address;
+}
+
+/*********************************************************************************************************************
+Interrupt service routine definition for the Timer2 compare match interrupt, which fires once the LCD has executed the
+previous entry of the asynchronous queue.
+*********************************************************************************************************************/
+ISR(TIMER2_COMP_vect)
+{
+	/* Milliseconds left of the current delay entry, and the type of the entry executed last: */
+	static uint8_t s_delay_remaining_ms = 0;
+#if (LCD_WAIT_MODE == LCD_BUSY_FLAG_POLLING)
+	static uint8_t s_last_entry_type = LCD_ENTRY_DELAY;
+#endif
+	uint8_t tail = g_lcd_queue_tail;
+	uint8_t value = 0;
+	uint8_t entry_type = LCD_ENTRY_DATA;
+	
+	if (0 != s_delay_remaining_ms)
+	{
+		/* OCR2 is still set to a millisecond: */
+		s_delay_remaining_ms--;
+		return;
+	}
+	
+#if (LCD_WAIT_MODE == LCD_BUSY_FLAG_POLLING)
+	/* The timer keeps firing every tick, and nothing is written until the LCD is ready. The busy flag can't be read
+	   before the interface is set up, so the initialization delays and nibbles are followed by fixed delays instead: */
+	if ((LCD_ENTRY_DATA >= s_last_entry_type) && (GPIO_PIN_HIGH == lcd_busy_flag_read()))
+	{
+		return;
+	}
+#endif
+	
+	if (tail == g_lcd_queue_head)
+	{
+		/* The queue is drained: */
+		TCCR2 = TIMER2_STOPPED;
+		g_lcd_async_busy = 0;
+	}
+	else
+	{
+		value = g_lcd_queue_value[tail];
+		entry_type = g_lcd_queue_type[tail];
+		tail++;
+		if (LCD_ASYNC_QUEUE_SIZE == tail)
+		{
+			tail = 0;
+		}
+		g_lcd_queue_tail = tail;
+#if (LCD_WAIT_MODE == LCD_BUSY_FLAG_POLLING)
+		s_last_entry_type = entry_type;
+#endif
+		
+		switch (entry_type)
+		{
+			case LCD_ENTRY_DELAY:
+			/* The delay is counted in milliseconds, since a longer one doesn't fit in OCR2: */
+			s_delay_remaining_ms = value - 1U;
+			OCR2 = LCD_TIMER2_TICKS(LCD_DELAY_TICK_TIME_US);
+			break;
+			
+#if (LCD_MODE == LCD_4BIT_OPERATION)
+			case LCD_ENTRY_NIBBLE:
+			gpio_pin_write_fast(LCD_CNTRL_PORT, LCD_RS, GPIO_PIN_LOW);
+			gpio_pin_write_fast(LCD_CNTRL_PORT, LCD_RW, GPIO_PIN_LOW);
+			lcd_nibble_write(value);
+			OCR2 = LCD_TIMER2_TICKS(LCD_FAST_EXECUTION_TIME_US);
 			break;
+#endif
+			
 			default:
+			lcd_bus_byte_write(value, entry_type);
+#if (LCD_WAIT_MODE == LCD_FIXED_DELAYS)
+			/* The next interrupt fires once the LCD has executed this entry: */
+			if ((LCD_ENTRY_COMMAND == entry_type) && (LCD_SLOW_COMMANDS_LIMIT > value))
+			{
+				OCR2 = LCD_TIMER2_TICKS(LCD_SLOW_EXECUTION_TIME_US);
+			}
+			else
+			{
+				OCR2 = LCD_TIMER2_TICKS(LCD_FAST_EXECUTION_TIME_US);
+			}
+#else
+			OCR2 = 0;
+#endif
 			break;
 		}
-		string[number_of_digits]=0;
+	}
+}
+
+void lcd_print_string(char* str)
+{
+	uint8_t i=0;
+	while (str[i]!=0)
+	{
+		lcd_character_write(str[i]);
+		i++;
+	}
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  lcd_print_string_P
+*
+** Description:
+*  This function prints a null-terminated string that lives in flash (PROGMEM), reading it directly from flash so 
+*  that it doesn't need to be copied to SRAM first.
+*
+** Input Parameters:
+*  - str_P: const char*
+*    Passes the address of the string in flash. For example: PSTR("Hello").
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+void lcd_print_string_P(const char* str_P)
+{
+	char character = pgm_read_byte(str_P);
+	while (character != 0)
+	{
+		lcd_character_write(character);
+		str_P++;
+		character = pgm_read_byte(str_P);
 	}
 }
 
@@ -33,11 +33,26 @@
 /*********************************************************************************************************************
                                                << File Inclusions >>
 *********************************************************************************************************************/
+#include <stdint.h>
 
 
 /*********************************************************************************************************************
                                                << Public Constants >>
 *********************************************************************************************************************/
+/* LCD_MODE options (see lcd_config.h): */
+#define   LCD_4BIT_OPERATION        (4U)
+#define   LCD_8BIT_OPERATION        (8U)
+
+/* LCD_WAIT_MODE options (see lcd_config.h): */
+#define   LCD_FIXED_DELAYS          (0U)
+#define   LCD_BUSY_FLAG_POLLING     (1U)
+
+/* LCD_SIZE options (see lcd_config.h): */
+#define   LCD_16x2                  (0U)
+#define   LCD_16x4                  (1U)
+#define   LCD_20x2                  (2U)
+#define   LCD_20x4                  (3U)
+#define   LCD_40x2                  (4U)
 
 
 /*********************************************************************************************************************
@@ -55,6 +70,12 @@ typedef enum
 
 	} lcd_command_t;
 
+typedef enum
+{
+	LCD_NOT_READY = 0,
+	LCD_READY
+} lcd_is_ready_t;
+
 /*********************************************************************************************************************
                                           << Public Variable Declarations >>
 *********************************************************************************************************************/
@@ -65,6 +86,30 @@ typedef enum
 *********************************************************************************************************************/
 extern void lcd_init(void);
 
+/*********************************************************************************************************************
+** Function Name:
+*  lcd_async_init
+*
+** Description:
+*  This function is the non-blocking alternative to lcd_init(). It configures the LCD pins, queues the power-on wait
+*  and the initialization commands, and returns immediately, so the rest of the system starts without waiting for 
+*  the LCD. The initialization is executed in the background by the asynchronous engine (see below), so the global 
+*  interrupts need to be enabled. The framebuffer, console and asynchronous functions can be used right away, and 
+*  anything they queue is executed after the initialization. The blocking functions wait until it's done.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - lcd_std_error_type_t
+*    Returns 'LCD_OK' if the initialization was queued, and 'LCD_NOT_OK' if the queue doesn't have enough space.
+*
+** Use Example:
+*  sei();
+*  lcd_async_init();
+*********************************************************************************************************************/
+extern lcd_std_error_type_t lcd_async_init(void);
+
 extern lcd_std_error_type_t lcd_gotoxy(uint8_t x, uint8_t y);
 
 extern lcd_std_error_type_t lcd_command_send(lcd_command_t lcd_command);
@@ -73,6 +118,334 @@ extern void lcd_character_write(uint8_t data_character);
 
 extern void lcd_print_string(char* str);
 
+extern void lcd_print_string_P(const char* str_P);
+
+/*********************************************************************************************************************
+** Asynchronous interfaces:
+*  The following functions add commands and characters to a queue and return immediately. The queue is drained in the 
+*  background by the Timer2 compare match interrupt, which writes one entry to the LCD and then waits only for the 
+*  execution time of that entry, so display updates don't block the CPU. The size of the queue is set by 
+*  LCD_ASYNC_QUEUE_SIZE in lcd_config.h. The global interrupts need to be enabled.
+*  Note that these functions use Timer2 and its compare match interrupt, so Timer2 can't be used by the application.
+*  The blocking functions above wait for the queue to be drained before accessing the LCD.
+*********************************************************************************************************************/
+/*********************************************************************************************************************
+** Function Name:
+*  lcd_async_command_send
+*
+** Description:
+*  This function adds a command to the asynchronous queue.
+*
+** Input Parameters:
+*  - lcd_command: lcd_command_t
+*    Command to send to the LCD.
+*
+** Return Value:
+*  - lcd_std_error_type_t
+*    Returns 'LCD_OK' if the command was queued, and 'LCD_NOT_OK' if the queue is full.
+*********************************************************************************************************************/
+extern lcd_std_error_type_t lcd_async_command_send(lcd_command_t lcd_command);
+
+/*********************************************************************************************************************
+** Function Name:
+*  lcd_async_character_write
+*
+** Description:
+*  This function adds a character to the asynchronous queue.
+*
+** Input Parameters:
+*  - data_character: uint8_t
+*    Character to write at the current cursor position.
+*
+** Return Value:
+*  - lcd_std_error_type_t
+*    Returns 'LCD_OK' if the character was queued, and 'LCD_NOT_OK' if the queue is full.
+*********************************************************************************************************************/
+extern lcd_std_error_type_t lcd_async_character_write(uint8_t data_character);
+
+/*********************************************************************************************************************
+** Function Name:
+*  lcd_async_gotoxy
+*
+** Description:
+*  This function adds a cursor move to the asynchronous queue.
+*
+** Input Parameters:
+*  - x: uint8_t
+*    Passes the desired character column number to the function.
+*  - y: uint8_t
+*    Passes the desired character line number to the function.
+*
+** Return Value:
+*  - lcd_std_error_type_t
+*    Returns 'LCD_OK' if the cursor move was queued, and 'LCD_NOT_OK' if the queue is full.
+*********************************************************************************************************************/
+extern lcd_std_error_type_t lcd_async_gotoxy(uint8_t x, uint8_t y);
+
+/*********************************************************************************************************************
+** Function Name:
+*  lcd_async_print_string
+*
+** Description:
+*  This function adds a null-terminated string to the asynchronous queue. Either the whole string is queued or none 
+*  of it.
+*
+** Input Parameters:
+*  - str: const char*
+*    Passes the string to print at the current cursor position.
+*
+** Return Value:
+*  - lcd_std_error_type_t
+*    Returns 'LCD_OK' if the string was queued, and 'LCD_NOT_OK' if there isn't enough space in the queue.
+*********************************************************************************************************************/
+extern lcd_std_error_type_t lcd_async_print_string(const char* str);
+
+/*********************************************************************************************************************
+** Function Name:
+*  lcd_async_queue_free_get
+*
+** Description:
+*  This function returns the number of free locations in the asynchronous queue, so that the application can check 
+*  that a whole update fits before queuing it.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - uint8_t
+*    Returns the number of commands and characters that can be queued.
+*********************************************************************************************************************/
+extern uint8_t lcd_async_queue_free_get(void);
+
+/*********************************************************************************************************************
+** Function Name:
+*  lcd_async_is_ready
+*
+** Description:
+*  This function returns whether everything in the asynchronous queue has been executed by the LCD.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - lcd_is_ready_t
+*    Returns "LCD_READY" if the queue is drained, and "LCD_NOT_READY" otherwise.
+*********************************************************************************************************************/
+extern lcd_is_ready_t lcd_async_is_ready(void);
+
+/*********************************************************************************************************************
+** Framebuffer interfaces:
+*  The driver keeps a copy of the whole display in RAM (the framebuffer). The application writes into the framebuffer
+*  as often as it likes, which costs no LCD access at all, and then calls lcd_fb_flush(). The flush sends only the 
+*  characters that were changed since the last flush, through the asynchronous queue. A run of neighbouring changed
+*  characters costs one cursor move, after which the LCD increments its address by itself, so refreshing a screen 
+*  where only a few digits changed costs a few queue entries instead of a cursor move and a write for every character.
+*  The framebuffer assumes it owns the display. If the other functions are used to write to the LCD, the framebuffer
+*  content doesn't match the display anymore.
+*********************************************************************************************************************/
+/*********************************************************************************************************************
+** Function Name:
+*  lcd_fb_character_write
+*
+** Description:
+*  This function writes a character into the framebuffer. The character is sent to the LCD by the next flush, only if
+*  it's different from what's already displayed.
+*
+** Input Parameters:
+*  - x: uint8_t
+*    Passes the character column number.
+*  - y: uint8_t
+*    Passes the character line number.
+*  - data_character: uint8_t
+*    Passes the character to write.
+*
+** Return Value:
+*  - lcd_std_error_type_t
+*    Returns 'LCD_OK' for correct character coordinates, and 'LCD_NOT_OK' if the x or y coordinates is wrong.
+*********************************************************************************************************************/
+extern lcd_std_error_type_t lcd_fb_character_write(uint8_t x, uint8_t y, uint8_t data_character);
+
+/*********************************************************************************************************************
+** Function Name:
+*  lcd_fb_string_write
+*
+** Description:
+*  This function writes a null-terminated string into the framebuffer starting at the given coordinates. The string 
+*  is clipped at the end of the line.
+*
+** Input Parameters:
+*  - x: uint8_t
+*    Passes the column number of the first character.
+*  - y: uint8_t
+*    Passes the line number.
+*  - str: const char*
+*    Passes the string to write.
+*
+** Return Value:
+*  - lcd_std_error_type_t
+*    Returns 'LCD_OK' if the whole string was written, and 'LCD_NOT_OK' if the coordinates are wrong or the string 
+*    was clipped.
+*********************************************************************************************************************/
+extern lcd_std_error_type_t lcd_fb_string_write(uint8_t x, uint8_t y, const char* str);
+
+/*********************************************************************************************************************
+** Function Name:
+*  lcd_fb_number_write
+*
+** Description:
+*  This function writes an unsigned number as decimal text into the framebuffer, right-aligned in the given width. 
+*  Only the digits that changed are sent by the next flush, so a counter that keeps changing costs little.
+*
+** Input Parameters:
+*  - x: uint8_t
+*    Passes the column number of the first character.
+*  - y: uint8_t
+*    Passes the line number.
+*  - value: uint32_t
+*    Passes the number to write.
+*  - width: uint8_t
+*    Passes the minimum number of characters, up to NUMBER_FORMAT_U32_DIGITS. Pass 0 for no padding.
+*  - padding: char
+*    Passes the padding character, NUMBER_FORMAT_PAD_SPACE or NUMBER_FORMAT_PAD_ZERO (see number_format.h).
+*
+** Return Value:
+*  - lcd_std_error_type_t
+*    Returns 'LCD_OK' if the whole number was written, and 'LCD_NOT_OK' if the coordinates or the width are wrong, or
+*    the number was clipped at the end of the line.
+*
+** Use Example:
+*  lcd_fb_string_write(0, 0, "Count:");
+*  lcd_fb_number_write(7, 0, packet_count, 5, NUMBER_FORMAT_PAD_SPACE);
+*  lcd_fb_flush();
+*********************************************************************************************************************/
+extern lcd_std_error_type_t lcd_fb_number_write(uint8_t x, uint8_t y, uint32_t value, uint8_t width, char padding);
+
+/*********************************************************************************************************************
+** Function Name:
+*  lcd_fb_clear
+*
+** Description:
+*  This function fills the framebuffer with spaces. Only the characters that aren't spaces already are sent by the 
+*  next flush.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+extern void lcd_fb_clear(void);
+
+/*********************************************************************************************************************
+** Function Name:
+*  lcd_fb_flush
+*
+** Description:
+*  This function adds the changed characters of the framebuffer to the asynchronous queue and returns immediately. If 
+*  the queue gets full, the remaining characters are kept marked as changed and sent by the next call, so the 
+*  function can simply be called every pass of the main loop.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - lcd_is_ready_t
+*    Returns "LCD_READY" if all the changed characters were queued, and "LCD_NOT_READY" if some are still waiting for 
+*    space in the queue.
+*
+** Use Example:
+*  lcd_fb_string_write(0, 0, "Speed:");
+*  lcd_fb_string_write(7, 0, speed_string);
+*  lcd_fb_flush();
+*********************************************************************************************************************/
+extern lcd_is_ready_t lcd_fb_flush(void);
+
+/*********************************************************************************************************************
+** Console interfaces:
+*  The following functions use the framebuffer as a scrolling text terminal, like a serial monitor. Characters are 
+*  written at the console cursor, the lines wrap, and a new line at the last line scrolls the framebuffer up. Only the
+*  framebuffer is changed, so the application calls lcd_fb_flush() to update the display, and can feed the console
+*  at any rate without waiting for the LCD.
+*********************************************************************************************************************/
+/*********************************************************************************************************************
+** Function Name:
+*  lcd_console_character_write
+*
+** Description:
+*  This function writes a character to the console. The following control characters are handled:
+*  '\r' moves to the start of the line, '\n' moves to the start of the next line, and '\b' erases the character 
+*  before the cursor. Other control characters are ignored.
+*
+** Input Parameters:
+*  - data_character: uint8_t
+*    Passes the character to write.
+*
+** Return Value:
+*  - void
+*
+** Use Example:
+*  while (UART_E_OK == uart_rx_buffer_read(&received_byte))
+*  {
+*      lcd_console_character_write(received_byte);
+*  }
+*  lcd_fb_flush();
+*********************************************************************************************************************/
+extern void lcd_console_character_write(uint8_t data_character);
+
+/*********************************************************************************************************************
+** Function Name:
+*  lcd_console_clear
+*
+** Description:
+*  This function clears the framebuffer and moves the console cursor to the first character.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+extern void lcd_console_clear(void);
+
+/*********************************************************************************************************************
+** Custom glyph interfaces:
+*  The LCD has eight CGRAM slots for custom 5x8 characters, displayed by writing character codes 0 to 7. The driver 
+*  keeps track of which glyphs are in the slots, so a glyph is uploaded only the first time it's used, and when all 
+*  slots are taken, the least recently used glyph is replaced. The glyphs are uploaded through the asynchronous queue.
+*  Note that replacing a glyph changes every character on the display that uses its code, so no more than eight 
+*  different glyphs should be visible at the same time.
+*********************************************************************************************************************/
+/*********************************************************************************************************************
+** Function Name:
+*  lcd_glyph_define
+*
+** Description:
+*  This function returns the character code of a glyph, uploading the glyph to a CGRAM slot first if it's not already
+*  in one. The cursor position is kept when the glyph is uploaded, unless it isn't known, like after a cursor or
+*  display shift command, in which case the cursor is moved to the first character.
+*
+** Input Parameters:
+*  - glyph_P: const uint8_t*
+*    Passes the address in flash (PROGMEM) of the 8 byte glyph bitmap, one byte per row, with the 5 least significant
+*    bits as the pixels. The address identifies the glyph, so each glyph needs to be stored only once.
+*  - character_code: uint8_t*
+*    This is a pointer to read back the character code to write to display the glyph.
+*
+** Return Value:
+*  - lcd_std_error_type_t
+*    Returns 'LCD_OK' if the glyph is ready to be written, and 'LCD_NOT_OK' if the glyph address is NULL or the queue
+*    can't hold the upload yet.
+*
+** Use Example:
+*  static const uint8_t bar_glyph[8] PROGMEM = {0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F, 0x1F};
+*  uint8_t bar_code;
+*  if (LCD_OK == lcd_glyph_define(bar_glyph, &bar_code))
+*  {
+*      lcd_fb_character_write(0, 1, bar_code);
+*  }
+*********************************************************************************************************************/
+extern lcd_std_error_type_t lcd_glyph_define(const uint8_t* glyph_P, uint8_t* character_code);
+
 
 
 #endif /* LCD_H_ */
@@ -37,18 +37,28 @@ required for the initialization and operation of the LCD.
 
 /* Choosing the LCD operation mode
 ** Options: 
-*  LCD_4BIT_OPERATION
+*  LCD_4BIT_OPERATION  Only LCD_D4 to LCD_D7 are used, which leaves the other four data port pins free.
 *  LCD_8BIT_OPERATION
 */
 #define LCD_MODE  LCD_8BIT_OPERATION
 
 
+/* Choosing how the driver waits for the LCD to execute a command or a character write
+** Options:
+*  LCD_FIXED_DELAYS       Waits for the worst-case execution time. The RW pin can be tied to the ground.
+*  LCD_BUSY_FLAG_POLLING  Reads the LCD busy flag (D7) and continues as soon as the LCD is ready. The RW pin needs
+*                         to be wired to the microcontroller.
+*/
+#define LCD_WAIT_MODE  LCD_FIXED_DELAYS
+
+
 /* Choosing the LCD size
 ** Options:
 *  LCD_16x2
 *  LCD_16x4
 *  LCD_20x2
 *  LCD_20x4
+*  LCD_40x2
 */
 #define LCD_SIZE LCD_16x2
 
@@ -107,4 +117,12 @@ required for the initialization and operation of the LCD.
 #define  LCD_RS	  GPIO_PIN0
 #define  LCD_RW	  GPIO_PIN1
 #define  LCD_EN   GPIO_PIN2
+
+
+/* Setting the size of the asynchronous command/data queue (see lcd_async_... functions in lcd.h).
+** Options:
+*  1 to 255. Every character or command takes one location. For lcd_async_init(), the size needs to be at least 6 in
+*  the 8 bit mode, and 14 in the 4 bit mode.
+*/
+#define  LCD_ASYNC_QUEUE_SIZE   (32U)
 #endif /* LCD_CONFIG_H_ */
\ No newline at end of file
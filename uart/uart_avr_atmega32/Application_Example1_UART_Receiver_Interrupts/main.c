@@ -23,36 +23,38 @@
 /*********************************************************************************************************************
                                                << File Inclusions >>
 *********************************************************************************************************************/
+#include <avr/io.h>
 #include <avr/interrupt.h>
 #include "uart_atmega32.h"
-#include "queue.h"
 #include "lcd.h"
 /*********************************************************************************************************************
                                               << Private Constants >>
 *********************************************************************************************************************/
 #define   INITIALIZE_TO_ZERO    0 
-#define   LCD_QUEUE_SIZE        13
-#define   LCD_FIRST_ROW         0
-#define   LCD_LAST_CHAR_INDEX   12
+#define   UART_RX_BUFFER_SIZE   64
 /* Baud Rate and Clock Frequency definition */
 #define   F_CPU              12000000UL
 #define   BAUDRATE           9600UL
+/* The LCD is refreshed at most LCD_FRAME_RATE_HZ times per second, using the Timer1 compare match A interrupt: */
+#define   LCD_FRAME_RATE_HZ        20UL
+#define   TIMER1_PRESCALER         64UL
+#define   TIMER1_CTC_PRESCALER_64  ((1<<WGM12)|(1<<CS11)|(1<<CS10))
 
 /*********************************************************************************************************************
                                               << Variable Definitions >>
 *********************************************************************************************************************/
-/* Creating a data buffer for the LCD queue: */
-static uint8_t lcd_queue_data_buffer[LCD_QUEUE_SIZE] = {INITIALIZE_TO_ZERO}; 
-/* Creating the LCD queue and initializing it:*/
-static queue_t lcd_display_queue = {.data_buffer = lcd_queue_data_buffer, .queue_size = LCD_QUEUE_SIZE,
-	                                .front_index = INITIALIZE_TO_ZERO, .rear_index = INITIALIZE_TO_ZERO};
+/* Creating the UART receive ring buffer. The UART receive interrupt fills it, and the console task empties it: */
+static uint8_t uart_rx_buffer[UART_RX_BUFFER_SIZE] = {INITIALIZE_TO_ZERO}; 
+
+/* Set by the Timer1 interrupt when it's time to refresh the LCD: */
+static volatile uint8_t lcd_frame_due = INITIALIZE_TO_ZERO;
 
 /*********************************************************************************************************************
                                               << Function Declarations >>
 *********************************************************************************************************************/
 static void uart_receiver_init(void);
-static void receive_task(void);
-static void display_task(void);
+static void lcd_frame_timer_init(void);
+static void console_task(void);
 
 
 	
@@ -74,12 +76,14 @@ static void display_task(void);
 ********************************************************************************************************************/
 int main(void)
 {
+    /* The UART is receiving right away, while the LCD is initialized in the background: */
     uart_receiver_init();
-    lcd_init();
+    lcd_async_init();
+    lcd_frame_timer_init();
 	
     while (1) 
     {
-	display_task(); 
+	console_task(); 
     }
 }
 
@@ -88,7 +92,7 @@ int main(void)
 *  uart_receiver_init
 *
 ** Description:
-*  Initializes the UART module.
+*  Initializes the UART module. The received bytes are stored in the receive ring buffer by the UART driver.
 *
 ** Input Parameters:
 *  - void
@@ -102,40 +106,41 @@ void uart_receiver_init(void)
  	uart_frame_format_select(UART_8BIT_CHARACTER_SIZE, UART_1STOP_BIT);
  	uart_synch_asynch_mode_select(UART_ASYNCHRONOUS_OPERATION);
  	uart_receiver_enable(); 
+	uart_rx_buffer_config(uart_rx_buffer, UART_RX_BUFFER_SIZE);
 	uart_receive_complete_interrupt_enable();
-	uart_receive_complete_interrupt_callback_set(&receive_task);
 	sei(); /* Enable global interrupts */
 }
 
 /********************************************************************************************************************
 ** Function Name:
-*  receive_task
+*  lcd_frame_timer_init
 *
 ** Description:
-*  This function runs in the receive complete interrupt routine once data is received by the UART receiver to add 
-*  it to the LCD data queue. 
+*  Starts Timer1 in the CTC mode, so that its compare match A interrupt fires LCD_FRAME_RATE_HZ times per second.
 *
 ** Input Parameters:
 *  - void
-*
 ** Return Value:
 *  - void
 ********************************************************************************************************************/
-void receive_task(void)
+void lcd_frame_timer_init(void)
 {
-	uint8_t uart_received_data = INITIALIZE_TO_ZERO;
-    /* Read new data: */
-	uart_received_data = uart_data_read();
-	/* Add the received data to the queue: */
-	queue_enqueue(&lcd_display_queue, uart_received_data);
+	TCCR1A = INITIALIZE_TO_ZERO;
+	TCNT1 = INITIALIZE_TO_ZERO;
+	OCR1A = (uint16_t)((F_CPU / (TIMER1_PRESCALER * LCD_FRAME_RATE_HZ)) - 1UL);
+	TIMSK |= (1<<OCIE1A);
+	TCCR1B = TIMER1_CTC_PRESCALER_64;
 }
 
 /********************************************************************************************************************
 ** Function Name:
-*  display_task
+*  console_task
 *
 ** Description:
-*  The display task checks if there's data in the LCD data queue and displays it on the LCD.
+*  The console task moves every received byte from the UART receive ring buffer to the LCD console, which only 
+*  changes the LCD framebuffer, so the ring buffer is emptied as fast as the bytes arrive. Once per LCD frame, the 
+*  framebuffer is flushed, which sends only the characters that changed to the LCD through the asynchronous queue. If
+*  the queue can't hold all of them, the rest are sent on the next calls.
 *
 ** Input Parameters:
 *  - void
@@ -143,31 +148,32 @@ void receive_task(void)
 ** Return Value:
 *  - void
 ********************************************************************************************************************/
-void display_task(void)
+void console_task(void)
 {
-	static uint8_t lcd_display_char_index = 0;
-	uint8_t lcd_display_char = INITIALIZE_TO_ZERO;
-	/* Checking if there is data in the queue: */
-	if (QUEUE_NOT_EMPTY == queue_isEmpty(&lcd_display_queue))
+	uint8_t received_byte = INITIALIZE_TO_ZERO;
+	
+	while (UART_E_OK == uart_rx_buffer_read(&received_byte))
 	{
-		/* Reading the data from the front of the queue: */
-		queue_dequeue(&lcd_display_queue, &lcd_display_char);
-		/* Go to the coordinates of the next character to display on the LCD: */
-		lcd_gotoxy(lcd_display_char_index, LCD_FIRST_ROW);
-		/* Displaying the next character: */
-		lcd_character_write(lcd_display_char);
-		lcd_display_char_index++;
+		lcd_console_character_write(received_byte);
 	}
 	
-	/* Check if the LCD has printed the last character: */
-	if ((LCD_LAST_CHAR_INDEX+1) == lcd_display_char_index)
+	if (INITIALIZE_TO_ZERO != lcd_frame_due)
 	{
-		/* Reset the display character index, so that the next time the LCD 
-		   will go to the first character coordinates. */
-		lcd_display_char_index = INITIALIZE_TO_ZERO;
+		if (LCD_READY == lcd_fb_flush())
+		{
+			lcd_frame_due = INITIALIZE_TO_ZERO;
+		}
 	}
 }
 
+/*********************************************************************************************************************
+Interrupt service routine definition for the Timer1 compare match A interrupt, which marks the start of a new LCD frame.
+*********************************************************************************************************************/
+ISR(TIMER1_COMPA_vect)
+{
+	lcd_frame_due = 1;
+}
+
 /*********************************************************************************************************************
                                                << End of File >>
 *********************************************************************************************************************/
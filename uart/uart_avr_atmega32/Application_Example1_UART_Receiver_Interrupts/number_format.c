@@ -0,0 +1,317 @@
+/*********************************************************************************************************************
+* Author : Alsayed Alsisi
+* Date   : Thursday, May 06, 2021
+* Version: 1.0
+* Contact: alsayed.alsisi@gmail.com
+* License:
+* You have the right to use the file as you wish in any educational or commercial purposes under the following
+* conditions:
+* [1] This file is to be used as is. No modifications are to be made to any part of the file, including this section.
+* [2] This section is not to be removed under any circumstances.
+* [3] Parts of the file may be used separately under the condition they are not modified, and preceded by this section.
+* [4] Any bug encountered in this file or parts of it should be reported to the email address given above to be fixed.
+* [5] No warranty is expressed or implied by the publication or distribution of this source code.
+*********************************************************************************************************************/
+/*********************************************************************************************************************
+* File Information:
+** File Name:
+*  number_format.c
+*
+** Description:
+*  This file contains the implementation of the number formatting library.
+*********************************************************************************************************************/
+
+
+/*********************************************************************************************************************
+                                               << File Inclusions >>
+*********************************************************************************************************************/
+#include <stdint.h>
+#include <avr/pgmspace.h>
+#include "number_format.h"
+
+/*********************************************************************************************************************
+                                              << Private Constants >>
+*********************************************************************************************************************/
+#define   DIGIT_ZERO                   ('0')
+#define   HEX_DIGIT_A                  ('A')
+#define   HEX_DIGIT_BITS               (4U)
+#define   HEX_DIGIT_MASK               (0x0FU)
+#define   DECIMAL_DIGITS_NUMBER        (10U)
+
+/*********************************************************************************************************************
+                                              << Private Data Types >>
+*********************************************************************************************************************/
+
+
+/*********************************************************************************************************************
+                                          << Private Variable Definitions >>
+*********************************************************************************************************************/
+/* Powers of ten of every digit except the last one, kept in flash: */
+static const uint32_t g_powers_of_ten_u32[NUMBER_FORMAT_U32_DIGITS - 1U] PROGMEM =
+{
+	1000000000UL, 100000000UL, 10000000UL, 1000000UL, 100000UL, 10000UL, 1000UL, 100UL, 10UL
+};
+static const uint16_t g_powers_of_ten_u16[NUMBER_FORMAT_U16_DIGITS - 1U] PROGMEM = {10000U, 1000U, 100U, 10U};
+
+/*********************************************************************************************************************
+                                          << Public Variable Definitions >>
+*********************************************************************************************************************/
+
+
+/*********************************************************************************************************************
+                                         << Private Functions Prototypes >>
+*********************************************************************************************************************/
+static uint8_t number_format_pad(const char* digits, uint8_t digits_count, uint8_t width, char padding, char* buffer);
+
+/*********************************************************************************************************************
+                                          << Public Function Definitions >>
+*********************************************************************************************************************/
+/*********************************************************************************************************************
+** Function Name:
+*  number_format_u8
+*
+** Description:
+*  This function converts an 8 bit unsigned number to null-terminated decimal text.
+*
+** Input Parameters:
+*  - value: uint8_t
+*    Passes the number to convert.
+*  - width: uint8_t
+*    Passes the minimum number of characters. Pass 0 for no padding.
+*  - padding: char
+*    Passes the padding character.
+*  - buffer: char*
+*    Passes the array to write the text to.
+*
+** Return Value:
+*  - uint8_t
+*    Returns the number of characters written, not including the null terminator.
+*********************************************************************************************************************/
+uint8_t number_format_u8(uint8_t value, uint8_t width, char padding, char* buffer)
+{
+	char digits[NUMBER_FORMAT_U8_DIGITS];
+
+	digits[0] = DIGIT_ZERO;
+	while (value >= 100U)
+	{
+		value -= 100U;
+		digits[0]++;
+	}
+	digits[1] = DIGIT_ZERO;
+	while (value >= 10U)
+	{
+		value -= 10U;
+		digits[1]++;
+	}
+	digits[2] = DIGIT_ZERO + value;
+
+	return number_format_pad(digits, NUMBER_FORMAT_U8_DIGITS, width, padding, buffer);
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  number_format_u16
+*
+** Description:
+*  This function converts a 16 bit unsigned number to null-terminated decimal text. Each digit is found by
+*  subtracting its power of ten until the number is smaller than it, which takes at most 9 subtractions per digit.
+*
+** Input Parameters:
+*  - value: uint16_t
+*    Passes the number to convert.
+*  - width: uint8_t
+*    Passes the minimum number of characters. Pass 0 for no padding.
+*  - padding: char
+*    Passes the padding character.
+*  - buffer: char*
+*    Passes the array to write the text to.
+*
+** Return Value:
+*  - uint8_t
+*    Returns the number of characters written, not including the null terminator.
+*********************************************************************************************************************/
+uint8_t number_format_u16(uint16_t value, uint8_t width, char padding, char* buffer)
+{
+	char digits[NUMBER_FORMAT_U16_DIGITS];
+	uint16_t power_of_ten = 0;
+	uint8_t i = 0;
+
+	for (i = 0; i < (NUMBER_FORMAT_U16_DIGITS - 1U); i++)
+	{
+		power_of_ten = pgm_read_word(&g_powers_of_ten_u16[i]);
+		digits[i] = DIGIT_ZERO;
+		while (value >= power_of_ten)
+		{
+			value -= power_of_ten;
+			digits[i]++;
+		}
+	}
+	digits[i] = DIGIT_ZERO + (uint8_t)value;
+
+	return number_format_pad(digits, NUMBER_FORMAT_U16_DIGITS, width, padding, buffer);
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  number_format_u32
+*
+** Description:
+*  This function converts a 32 bit unsigned number to null-terminated decimal text, the same way as
+*  number_format_u16(). Numbers that fit in 16 bits are passed to number_format_u16() instead.
+*
+** Input Parameters:
+*  - value: uint32_t
+*    Passes the number to convert.
+*  - width: uint8_t
+*    Passes the minimum number of characters. Pass 0 for no padding.
+*  - padding: char
+*    Passes the padding character.
+*  - buffer: char*
+*    Passes the array to write the text to.
+*
+** Return Value:
+*  - uint8_t
+*    Returns the number of characters written, not including the null terminator.
+*********************************************************************************************************************/
+uint8_t number_format_u32(uint32_t value, uint8_t width, char padding, char* buffer)
+{
+	char digits[NUMBER_FORMAT_U32_DIGITS];
+	uint32_t power_of_ten = 0;
+	uint8_t length = 0;
+	uint8_t i = 0;
+
+	if (UINT16_MAX >= value)
+	{
+		length = number_format_u16((uint16_t)value, width, padding, buffer);
+	}
+	else
+	{
+		for (i = 0; i < (NUMBER_FORMAT_U32_DIGITS - 1U); i++)
+		{
+			power_of_ten = pgm_read_dword(&g_powers_of_ten_u32[i]);
+			digits[i] = DIGIT_ZERO;
+			while (value >= power_of_ten)
+			{
+				value -= power_of_ten;
+				digits[i]++;
+			}
+		}
+		digits[i] = DIGIT_ZERO + (uint8_t)value;
+
+		length = number_format_pad(digits, NUMBER_FORMAT_U32_DIGITS, width, padding, buffer);
+	}
+
+	return length;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  number_format_hex
+*
+** Description:
+*  This function converts a number to null-terminated hexadecimal text with a fixed number of upper case digits,
+*  starting from the lowest digit.
+*
+** Input Parameters:
+*  - value: uint32_t
+*    Passes the number to convert.
+*  - digits: uint8_t
+*    Passes the number of digits, from 1 to NUMBER_FORMAT_HEX_DIGITS.
+*  - buffer: char*
+*    Passes the array to write the text to.
+*
+** Return Value:
+*  - uint8_t
+*    Returns the number of characters written, which is 0 if the number of digits is wrong.
+*********************************************************************************************************************/
+uint8_t number_format_hex(uint32_t value, uint8_t digits, char* buffer)
+{
+	uint8_t length = 0;
+	uint8_t digit = 0;
+
+	if ((0 != digits) && (NUMBER_FORMAT_HEX_DIGITS >= digits))
+	{
+		length = digits;
+		buffer[digits] = 0;
+		while (0 != digits)
+		{
+			digits--;
+			digit = (uint8_t)value & HEX_DIGIT_MASK;
+			if (DECIMAL_DIGITS_NUMBER > digit)
+			{
+				buffer[digits] = DIGIT_ZERO + digit;
+			}
+			else
+			{
+				buffer[digits] = HEX_DIGIT_A + (digit - DECIMAL_DIGITS_NUMBER);
+			}
+			value >>= HEX_DIGIT_BITS;
+		}
+	}
+	else
+	{
+		buffer[0] = 0;
+	}
+
+	return length;
+}
+
+/*********************************************************************************************************************
+                                          << Private Function Definitions >>
+*********************************************************************************************************************/
+/*********************************************************************************************************************
+** Function Name:
+*  number_format_pad
+*
+** Description:
+*  This function copies the significant digits of a number to the buffer, after the padding needed to reach the
+*  width, and adds the null terminator.
+*
+** Input Parameters:
+*  - digits: const char*
+*    Passes the digits of the number, with leading zeros.
+*  - digits_count: uint8_t
+*    Passes the number of digits.
+*  - width: uint8_t
+*    Passes the minimum number of characters.
+*  - padding: char
+*    Passes the padding character.
+*  - buffer: char*
+*    Passes the array to write the text to.
+*
+** Return Value:
+*  - uint8_t
+*    Returns the number of characters written, not including the null terminator.
+*********************************************************************************************************************/
+static uint8_t number_format_pad(const char* digits, uint8_t digits_count, uint8_t width, char padding, char* buffer)
+{
+	uint8_t first_digit = 0;
+	uint8_t length = 0;
+
+	/* Skipping the leading zeros. The last digit is always kept, so zero is written as "0": */
+	while (((digits_count - 1U) > first_digit) && (DIGIT_ZERO == digits[first_digit]))
+	{
+		first_digit++;
+	}
+
+	while (width > (digits_count - first_digit))
+	{
+		buffer[length] = padding;
+		length++;
+		width--;
+	}
+
+	while (digits_count > first_digit)
+	{
+		buffer[length] = digits[first_digit];
+		length++;
+		first_digit++;
+	}
+	buffer[length] = 0;
+
+	return length;
+}
+
+/*********************************************************************************************************************
+                                                << End of File >>
+*********************************************************************************************************************/
@@ -27,7 +27,10 @@
 *********************************************************************************************************************/
 #include <avr/io.h>
 #include <avr/interrupt.h>
+#include <avr/pgmspace.h>
+#include <util/crc16.h>
 #include <stdint.h>
+#include <stddef.h>
 #include "uart_atmega32.h"
 #include "bit_math.h"
 
@@ -45,9 +48,38 @@
 #define   UCSZ_8BIT_CHAR_SIZE_SELECTED   0x06    /* UCSZ1:0 = 11 */
 #define   UCSZ_9BIT_CHAR_SIZE_SELECTED   0x06    /* UCSZ1:0 = 11 */
 
+/******************************************** Frame Size-relating Macros ********************************************/
+#define   START_BIT_COUNT                (1U)
+#define   DEFAULT_CHARACTER_BIT_COUNT    (8U)    /* UCSZ2:0 = 011 after reset */
+#define   DEFAULT_STOP_BIT_COUNT         (1U)
+#define   BAUDRATE_CLOCK_DIVIDER         (16UL)  /* Asynchronous normal mode: one bit lasts 16*(UBRR+1) CPU cycles */
+
+/******************************************** Timer0 Idle Timeout-relating Macros ***********************************/
+#define   TIMER0_PRESCALER_COUNT         (5U)
+#define   TIMER0_MAX_COUNT               (256UL)
+#define   TIMER0_CTC_MODE                (1<<WGM01)
+#define   TIMER0_STOPPED                 (0x00)
+
+/******************************************** Ping-pong Buffers-relating Macros *************************************/
+#define   PINGPONG_BUFFER_COUNT          (2U)
+#define   ASCII_LF                       ('\n')
+#define   ASCII_CR                       ('\r')
+
+/******************************************** Scatter-gather Transmit-relating Macros *******************************/
+#define   CRC16_INITIAL_VALUE            (0xFFFFU)
+#define   CRC16_SIZE                     (2U)
+
 /*********************************************************************************************************************
                                               << Private Data Types >>
 *********************************************************************************************************************/
+/* Selects what the receive complete interrupt service routine does with the received byte: */
+typedef enum
+{
+	UART_RX_CALLBACK_MODE = 0,   /* The receive complete callback reads the byte. */
+	UART_RX_BUFFERED_MODE,       /* The byte is stored in the receive ring buffer. */
+	UART_RX_LINE_MODE,           /* The byte is assembled into a line in the ping-pong buffers. */
+	UART_RX_FRAME_MODE           /* The byte is stored in the current fixed-size frame of the ping-pong buffers. */
+} uart_rx_mode_t;
 
 
 /*********************************************************************************************************************
@@ -55,6 +87,62 @@
 *********************************************************************************************************************/
 static void (*g_tx_complete_callback)(void);
 static void (*g_rx_complete_callback)(void);
+static void (*g_rx_idle_callback)(uint8_t frame_length);
+static uart_rx_mode_t g_rx_mode = UART_RX_CALLBACK_MODE;
+
+/* Receive ring buffer, filled by the receive complete interrupt in buffered operation: */
+static uint8_t* g_rx_buffer = NULL;
+static uint8_t g_rx_buffer_size = INITIALIZE_TO_ZERO;
+static volatile uint8_t g_rx_buffer_head = INITIALIZE_TO_ZERO;   /* Written only by the interrupt routine */
+static volatile uint8_t g_rx_buffer_tail = INITIALIZE_TO_ZERO;   /* Written only by uart_rx_buffer_read */
+
+/* Ping-pong buffers: the interrupt fills one buffer, while the application owns the other one once it's ready. */
+static uint8_t* g_rx_pingpong_buffers[PINGPONG_BUFFER_COUNT] = {NULL, NULL};
+static uint8_t g_rx_pingpong_buffer_size = INITIALIZE_TO_ZERO;
+static uint8_t g_rx_pingpong_fill_index = INITIALIZE_TO_ZERO;
+static uint8_t g_rx_pingpong_fill_length = INITIALIZE_TO_ZERO;
+static volatile uint8_t g_rx_pingpong_ready = INITIALIZE_TO_ZERO;
+static volatile uint8_t g_rx_pingpong_ready_length = INITIALIZE_TO_ZERO;
+static void (*g_rx_pingpong_ready_callback)(void);
+
+/* Scatter-gather transmission: */
+static void (*g_tx_writev_complete_callback)(void);
+static volatile uint8_t g_tx_writev_active = INITIALIZE_TO_ZERO;
+static const uart_iovec_t* g_tx_iovec = NULL;           /* Next descriptor to be loaded */
+static uint8_t g_tx_iovec_left = INITIALIZE_TO_ZERO;      /* Number of descriptors not loaded yet */
+static const uint8_t* g_tx_data = NULL;                  /* Next byte of the current descriptor */
+static uint16_t g_tx_data_left = INITIALIZE_TO_ZERO;     /* Bytes left in the current descriptor */
+static uint8_t g_tx_data_flags = UART_IOVEC_RAM;         /* Flags of the current descriptor */
+static uint16_t g_tx_crc = CRC16_INITIAL_VALUE;
+static uint8_t g_tx_crc_bytes[CRC16_SIZE];
+static uart_iovec_t g_tx_string_iovec = {NULL, INITIALIZE_TO_ZERO, UART_IOVEC_PROGMEM};  /* Used by uart_write_P */
+
+/* Line assembly terminators: */
+static uint8_t g_rx_line_terminator_set = INITIALIZE_TO_ZERO;
+static uint8_t g_rx_line_custom_terminator = INITIALIZE_TO_ZERO;
+
+/* Current frame format, used to calculate the idle-line timeout: */
+static uint16_t g_baudrate_register_value = INITIALIZE_TO_ZERO;
+static uint8_t g_character_bit_count = DEFAULT_CHARACTER_BIT_COUNT;
+static uint8_t g_parity_bit_count = INITIALIZE_TO_ZERO;
+static uint8_t g_stop_bit_count = DEFAULT_STOP_BIT_COUNT;
+
+/* Idle-line detection: */
+static uint8_t g_rx_idle_detection_enabled = INITIALIZE_TO_ZERO;
+static uint8_t g_rx_idle_timer_clock_select = TIMER0_STOPPED;
+static uint8_t g_rx_idle_timer_periods = INITIALIZE_TO_ZERO;
+static volatile uint8_t g_rx_idle_timer_periods_left = INITIALIZE_TO_ZERO;
+static volatile uint8_t g_rx_idle_frame_length = INITIALIZE_TO_ZERO;
+
+/* Timer0 prescaler options as (log2 of the division factor, CS02:0 value): */
+static const uint8_t g_timer0_prescalers[TIMER0_PRESCALER_COUNT][2] = 
+{
+	{0U,  (1<<CS00)},               /* clk/1    */
+	{3U,  (1<<CS01)},               /* clk/8    */
+	{6U,  ((1<<CS01)|(1<<CS00))},   /* clk/64   */
+	{8U,  (1<<CS02)},               /* clk/256  */
+	{10U, ((1<<CS02)|(1<<CS00))}    /* clk/1024 */
+};
 
 /*********************************************************************************************************************
                                           << Public Variable Definitions >>
@@ -66,6 +154,12 @@ static void (*g_rx_complete_callback)(void);
 *********************************************************************************************************************/
 static uart_std_error_type_t uart_character_size_select(uart_character_size_t uart_character_size);
 static uart_std_error_type_t uart_stop_bit_size_select(uart_stop_bit_size_t uart_stop_bit_size);
+static void uart_rx_idle_timer_restart(void);
+static void uart_rx_line_byte_store(uint8_t data_byte);
+static void uart_rx_pingpong_buffer_complete(void);
+static uart_std_error_type_t uart_rx_pingpong_buffers_set(uint8_t* buffer_0, uint8_t* buffer_1, uint8_t buffer_size);
+static uint8_t uart_writev_iovec_load(void);
+static void uart_writev_byte_send(void);
 
 /*********************************************************************************************************************
                                           << Public Function Definitions >>
@@ -102,6 +196,7 @@ uart_std_error_type_t uart_baud_rate_config(uint32_t baudrate, uint32_t sys_osc_
 		/* Baud rate value is within range */
 		return_error = UART_E_OK;
 		baudrate_register_value = (sys_osc_clock_freq / (16UL*baudrate))-1;
+		g_baudrate_register_value = baudrate_register_value;
 		UBRRH = (uint8_t)(baudrate_register_value>> SHIFT_BY_EIGHT);
 		UBRRL = (uint8_t)baudrate_register_value;
 	}
@@ -212,16 +307,19 @@ uart_std_error_type_t uart_parity_mode_select(uart_parity_mode_t uart_parity_mod
 	{
 		case UART_PARITY_DISABLED:
 		UCSRC = ((UCSRC & (~((1<<UPM1)|(1<<UPM0)))) | (1<<URSEL));
+		g_parity_bit_count = 0;
 		return_error = UART_E_OK;
 		break;
 		
 		case UART_EVEN_PARITY:
 		UCSRC = ((UCSRC & (~(1<<UPM0))) | ((1<<UPM1)|(1<<URSEL)));
+		g_parity_bit_count = 1;
 		return_error = UART_E_OK;
 		break;
 		
 		case UART_ODD_PARITY:
 		UCSRC = (UCSRC | ((1<<UPM1)|(1<<UPM0)|(1<<URSEL)));
+		g_parity_bit_count = 1;
 		return_error = UART_E_OK;
 		break;
 		/* error: wrong configuration. */
@@ -417,6 +515,134 @@ void uart_data_write(uint8_t data_byte)
 	UDR = data_byte;
 }
 
+/*********************************************************************************************************************
+** Function Name:
+*  uart_writev
+*
+** Description:
+*  This function starts the scatter-gather transmission of the frame described by the passed descriptors. The data
+*  register empty interrupt transmits the data directly from where it lives.
+*
+** Input Parameters:
+*  - iovec: const uart_iovec_t*
+*    Passes the address of the array of descriptors.
+*  - iovec_count: uint8_t
+*    Passes the number of descriptors in the array.
+*
+** Return Value:
+*  - uart_std_error_type_t
+*    The return value returns UART_E_OK if the transmission started, and returns "UART_E_NOT_OK" if the descriptors
+*    are wrong, a previous transmission is still in progress, or the transmit complete interrupt is enabled.
+*********************************************************************************************************************/
+uart_std_error_type_t uart_writev(const uart_iovec_t* iovec, uint8_t iovec_count)
+{
+	uart_std_error_type_t return_error = UART_E_NOT_OK;
+	
+	if ((NULL == iovec) || (INITIALIZE_TO_ZERO != g_tx_writev_active) || (INITIALIZE_TO_ZERO != BIT_GET(UCSRB, UDRIE)))
+	{
+		/* Error: no descriptors, the previous transmission isn't complete yet, or the data register empty interrupt
+		   is owned by the transmit complete callback. */
+		return_error = UART_E_NOT_OK;
+	}
+	else
+	{
+		g_tx_iovec = iovec;
+		g_tx_iovec_left = iovec_count;
+		g_tx_crc = CRC16_INITIAL_VALUE;
+		/* Starting the interrupt only if there's something to transmit: */
+		if (INITIALIZE_TO_ZERO != uart_writev_iovec_load())
+		{
+			g_tx_writev_active = 1U;
+			BIT_SET(UCSRB, UDRIE);
+		}
+		return_error = UART_E_OK;
+	}
+	
+	return return_error;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  uart_writev_is_ready
+*
+** Description:
+*  This function returns whether a new uart_writev transmission can be started.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - uart_is_ready_t
+*    Returns "UART_READY" if no uart_writev transmission is in progress, and "UART_NOT_READY" otherwise.
+*********************************************************************************************************************/
+uart_is_ready_t uart_writev_is_ready(void)
+{
+	uart_is_ready_t return_value = UART_NOT_READY;
+	
+	if (INITIALIZE_TO_ZERO == g_tx_writev_active)
+	{
+		return_value = UART_READY;
+	}
+	
+	return return_value;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  uart_writev_complete_callback_set
+*
+** Description:
+*  This function is used to pass the address of the function that will be called once the last byte of a uart_writev
+*  transmission is written to the UART data register.
+*
+** Input Parameters:
+*  - void (*writev_complete_callback)(void)
+*    Passes the address of the function that will be executed in the data register empty interrupt service routine.
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+void uart_writev_complete_callback_set(void (*writev_complete_callback)(void))
+{
+	g_tx_writev_complete_callback = writev_complete_callback;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  uart_write_P
+*
+** Description:
+*  This function starts the transmission of a null-terminated string that lives in flash, using a single PROGMEM
+*  descriptor of the scatter-gather transmission.
+*
+** Input Parameters:
+*  - string_P: const char*
+*    Passes the address of the string in flash.
+*
+** Return Value:
+*  - uart_std_error_type_t
+*    The return value returns UART_E_OK if the transmission started, and returns "UART_E_NOT_OK" if the string address
+*    is wrong, a previous transmission is still in progress, or the transmit complete interrupt is enabled.
+*********************************************************************************************************************/
+uart_std_error_type_t uart_write_P(const char* string_P)
+{
+	uart_std_error_type_t return_error = UART_E_NOT_OK;
+	
+	if ((NULL == string_P) || (INITIALIZE_TO_ZERO != g_tx_writev_active))
+	{
+		/* Error: no string, or the descriptor is still being transmitted. */
+		return_error = UART_E_NOT_OK;
+	}
+	else
+	{
+		g_tx_string_iovec.data = (const uint8_t*)string_P;
+		g_tx_string_iovec.length = (uint16_t)strlen_P(string_P);
+		return_error = uart_writev(&g_tx_string_iovec, 1U);
+	}
+	
+	return return_error;
+}
+
 /*********************************************************************************************************************
 ** Function Name:
 *  uart_receiver_enable
@@ -563,82 +789,190 @@ uint8_t uart_data_read(void)
 	
 }
 
-
 /*********************************************************************************************************************
-                                          << Private Function Definitions >>
+** Function Name:
+*  uart_rx_buffer_config
+*
+** Description:
+*  This function switches the receive complete interrupt to buffered operation, where the received bytes are stored 
+*  in the passed ring buffer instead of calling the receive complete callback.
+*
+** Input Parameters:
+*  - rx_buffer: uint8_t*
+*    Passes the address of the array that will be used as the receive ring buffer.
+*  - rx_buffer_size: uint8_t
+*    Passes the size of the receive ring buffer array. It needs to be 2 or more.
+*
+** Return Value:
+*  - uart_std_error_type_t
+*    The return value returns UART_E_OK if the buffer is valid, and returns "UART_E_NOT_OK" otherwise.
 *********************************************************************************************************************/
+uart_std_error_type_t uart_rx_buffer_config(uint8_t* rx_buffer, uint8_t rx_buffer_size)
+{
+	uart_std_error_type_t return_error = UART_E_NOT_OK;
+	
+	if ((NULL == rx_buffer) || (2U > rx_buffer_size))
+	{
+		/* Error: a ring buffer needs at least one free location besides the stored bytes. */
+		return_error = UART_E_NOT_OK;
+	}
+	else
+	{
+		/* The interrupt mustn't use the buffer while it's being changed: */
+		BIT_CLEAR(UCSRB, RXCIE);
+		g_rx_buffer = rx_buffer;
+		g_rx_buffer_size = rx_buffer_size;
+		g_rx_buffer_head = INITIALIZE_TO_ZERO;
+		g_rx_buffer_tail = INITIALIZE_TO_ZERO;
+		g_rx_mode = UART_RX_BUFFERED_MODE;
+		BIT_SET(UCSRB, RXCIE);
+		return_error = UART_E_OK;
+	}
+	
+	return return_error;
+}
+
 /*********************************************************************************************************************
-Interrupt service routine definition for the UART transmit ready interrupt
+** Function Name:
+*  uart_rx_buffer_read
+*
+** Description:
+*  This function reads the oldest byte from the receive ring buffer.
+*
+** Input Parameters:
+*  - data_byte: uint8_t*
+*    This a pointer to read back the received byte in the caller function.
+*
+** Return Value:
+*  - uart_std_error_type_t
+*    The return value returns UART_E_OK if a byte was read, and returns "UART_E_NOT_OK" if the buffer is empty.
 *********************************************************************************************************************/
-ISR(USART_UDRE_vect)
+uart_std_error_type_t uart_rx_buffer_read(uint8_t* data_byte)
 {
-	g_tx_complete_callback();
+	uart_std_error_type_t return_error = UART_E_NOT_OK;
+	uint8_t tail = g_rx_buffer_tail;
+	
+	/* Checking if the buffer is not empty: */
+	if (tail != g_rx_buffer_head)
+	{
+		*data_byte = g_rx_buffer[tail];
+		tail++;
+		if (g_rx_buffer_size == tail)
+		{
+			tail = INITIALIZE_TO_ZERO;
+		}
+		/* A single byte store, so the interrupt always sees either the old or the new tail: */
+		g_rx_buffer_tail = tail;
+		return_error = UART_E_OK;
+	}
+	
+	return return_error;
 }
 
 /*********************************************************************************************************************
-Interrupt service routine definition for the UART receive complete interrupt.
+** Function Name:
+*  uart_rx_buffer_count
+*
+** Description:
+*  This function returns the number of received bytes waiting in the receive ring buffer.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - uint8_t
+*    Returns the number of bytes that can be read from the receive ring buffer.
 *********************************************************************************************************************/
-ISR(USART_RXC_vect)
+uint8_t uart_rx_buffer_count(void)
 {
-	g_rx_complete_callback();
+	uint8_t head = g_rx_buffer_head;
+	uint8_t tail = g_rx_buffer_tail;
+	uint8_t return_value = INITIALIZE_TO_ZERO;
+	
+	if (head >= tail)
+	{
+		return_value = head - tail;
+	}
+	else
+	{
+		return_value = (g_rx_buffer_size - tail) + head;
+	}
+	
+	return return_value;
 }
+
 /*********************************************************************************************************************
 ** Function Name:
-*  uart_character_size_select
+*  uart_rx_idle_detection_enable
 *
 ** Description:
-*  This function configures the UART to work with the selected character size passed to it.
+*  This function enables the idle-line event. The timeout is calculated once here from the current baud rate register
+*  value and frame format, so that the receive complete interrupt only needs to restart Timer0 on every byte.
 *
 ** Input Parameters:
-*  - uart_character_size: uart_character_size_t
-*    This parameters is used to pass user's selection of character size to the function. Different options can be 
-*    found in the specification of the datatype. 
+*  - rx_idle_callback: void (*)(uint8_t frame_length)
+*    Passes the address of the function that will be executed in the Timer0 interrupt service routine once the line
+*    becomes idle, or NULL if no callback is needed.
 *
 ** Return Value:
 *  - uart_std_error_type_t
-*    The return value returns UART_E_OK if the selected configuration is correct, and returns "UART_E_NOT_OK" if
-*    the selected configuration is wrong.
+*    The return value returns UART_E_OK if the timeout fits Timer0, and returns "UART_E_NOT_OK" otherwise.
 *********************************************************************************************************************/
-static uart_std_error_type_t uart_character_size_select(uart_character_size_t uart_character_size)
+uart_std_error_type_t uart_rx_idle_detection_enable(void (*rx_idle_callback)(uint8_t frame_length))
 {
 	uart_std_error_type_t return_error = UART_E_NOT_OK;
+	uint32_t timeout_cpu_cycles = INITIALIZE_TO_ZERO;
+	uint32_t timeout_timer_ticks = INITIALIZE_TO_ZERO;
+	uint8_t timer_periods = 1U;
+	uint8_t prescaler_index = INITIALIZE_TO_ZERO;
+	uint8_t frame_bit_count = START_BIT_COUNT + g_character_bit_count + g_parity_bit_count + g_stop_bit_count;
 	
-	switch (uart_character_size)
+	/* One bit lasts 16*(UBRR+1) CPU cycles, so the timeout doesn't depend on how the baud rate was rounded: */
+	timeout_cpu_cycles = BAUDRATE_CLOCK_DIVIDER * ((uint32_t)g_baudrate_register_value + 1UL) * frame_bit_count 
+	                     * UART_RX_IDLE_TIMEOUT_CHARACTERS;
+	
+	/* Looking for the smallest prescaler that fits the timeout in a single Timer0 period: */
+	for (prescaler_index = 0; prescaler_index < TIMER0_PRESCALER_COUNT; prescaler_index++)
 	{
-		/* Selecting 5-bit Character size --> UCSZ2 = 0 and UCSZ1:0 = 00 */
-		case UART_5BIT_CHARACTER_SIZE:
-		BIT_CLEAR(UCSRB, UCSZ2);
-		UCSRC = ((UCSRC & UCSZ_BITS_MASK_WITH_ZEROs) | UCSZ_5BIT_CHAR_SIZE_SELECTED);
-		break;
-		
-		/* Selecting 6-bit Character size --> UCSZ2 = 0 and UCSZ1:0 = 01 */ 
-		case UART_6BIT_CHARACTER_SIZE:
-		BIT_CLEAR(UCSRB, UCSZ2);
-		UCSRC = ((UCSRC & UCSZ_BITS_MASK_WITH_ZEROs) | UCSZ_6BIT_CHAR_SIZE_SELECTED);
-		break;
-		
-		/* Selecting 7-bit Character size --> UCSZ2 = 0 and UCSZ1:0 = 10 */
-		case UART_7BIT_CHARACTER_SIZE:
-		BIT_CLEAR(UCSRB, UCSZ2);
-		UCSRC = ((UCSRC & UCSZ_BITS_MASK_WITH_ZEROs) | UCSZ_7BIT_CHAR_SIZE_SELECTED);
-		break;
-		
-		/* Selecting 8-bit Character size --> UCSZ2 = 0 and UCSZ1:0 = 11 */
-		case UART_8BIT_CHARACTER_SIZE:
-		BIT_CLEAR(UCSRB, UCSZ2);
-		UCSRC = ((UCSRC & UCSZ_BITS_MASK_WITH_ZEROs) | UCSZ_8BIT_CHAR_SIZE_SELECTED);
-		break;
-		
-		/* Selecting 9-bit Character size --> UCSZ2 = 1 and UCSZ1:0 = 11*/
-		case UART_9BIT_CHARACTER_SIZE:
-		BIT_SET(UCSRB, UCSZ2);
-		UCSRC = ((UCSRC & UCSZ_BITS_MASK_WITH_ZEROs) | UCSZ_9BIT_CHAR_SIZE_SELECTED);
-		break;
-		
-		/* Error: Wrong configurations */
-		default:
+		timeout_timer_ticks = timeout_cpu_cycles >> g_timer0_prescalers[prescaler_index][0];
+		if (TIMER0_MAX_COUNT >= timeout_timer_ticks)
+		{
+			break;
+		}
+	}
+	
+	if (TIMER0_PRESCALER_COUNT == prescaler_index)
+	{
+		/* Slow baud rates: the largest prescaler is used, and the timeout is split into several equal periods. */
+		prescaler_index = TIMER0_PRESCALER_COUNT - 1U;
+		timeout_timer_ticks = timeout_cpu_cycles >> g_timer0_prescalers[prescaler_index][0];
+		if (((TIMER0_MAX_COUNT * UINT8_MAX)) < timeout_timer_ticks)
+		{
+			timer_periods = INITIALIZE_TO_ZERO; /* Timeout is too long for Timer0. */
+		}
+		else
+		{
+			timer_periods = (uint8_t)((timeout_timer_ticks + TIMER0_MAX_COUNT - 1UL) / TIMER0_MAX_COUNT);
+			timeout_timer_ticks = timeout_timer_ticks / timer_periods;
+		}
+	}
+	
+	if ((INITIALIZE_TO_ZERO == timer_periods) || (INITIALIZE_TO_ZERO == timeout_timer_ticks))
+	{
+		/* Error: the timeout can't be generated by Timer0. */
 		return_error = UART_E_NOT_OK;
-		break;
+	}
+	else
+	{
+		TCCR0 = TIMER0_STOPPED;
+		OCR0 = (uint8_t)(timeout_timer_ticks - 1UL);  /* CTC period is OCR0+1 ticks */
+		g_rx_idle_timer_clock_select = g_timer0_prescalers[prescaler_index][1];
+		g_rx_idle_timer_periods = timer_periods;
+		g_rx_idle_frame_length = INITIALIZE_TO_ZERO;
+		g_rx_idle_callback = rx_idle_callback;
+		g_rx_idle_detection_enabled = 1U;
+		BIT_SET(TIMSK, OCIE0);
+		return_error = UART_E_OK;
 	}
 	
 	return return_error;
@@ -646,37 +980,459 @@ static uart_std_error_type_t uart_character_size_select(uart_character_size_t ua
 
 /*********************************************************************************************************************
 ** Function Name:
-*  uart_stop_bit_size_select
+*  uart_rx_idle_detection_disable
 *
 ** Description:
-*  This function configures the UART to work with the selected stop bit size passed to it.
+*  This function disables the idle-line event and stops Timer0.
 *
 ** Input Parameters:
-*  - uart_stop_bit_size: uart_stop_bit_size_t
-*    This parameters is used to pass the stop bit size selection to the function.
+*  - void
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+void uart_rx_idle_detection_disable(void)
+{
+	TCCR0 = TIMER0_STOPPED;
+	BIT_CLEAR(TIMSK, OCIE0);
+	g_rx_idle_detection_enabled = INITIALIZE_TO_ZERO;
+	g_rx_idle_callback = NULL;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  uart_rx_line_mode_enable
+*
+** Description:
+*  This function switches the receive complete interrupt to line assembly operation using the two passed line 
+*  buffers as ping-pong buffers.
+*
+** Input Parameters:
+*  - line_buffer_0: uint8_t*
+*    Passes the address of the first line buffer array.
+*  - line_buffer_1: uint8_t*
+*    Passes the address of the second line buffer array.
+*  - line_max_length: uint8_t
+*    Passes the size of each of the line buffer arrays, which is also the maximum line length.
+*  - terminator_set: uint8_t
+*    Passes the selected terminators. For example: (UART_LINE_TERMINATOR_LF | UART_LINE_TERMINATOR_CR).
+*  - custom_terminator: uint8_t
+*    Passes the custom terminator byte, used only if UART_LINE_TERMINATOR_CUSTOM is selected.
 *
 ** Return Value:
 *  - uart_std_error_type_t
-*    The return value returns UART_E_OK if the selected configuration is correct, and returns "UART_E_NOT_OK" if
-*    the selected configuration is wrong.
+*    The return value returns UART_E_OK if the configurations are correct, and returns "UART_E_NOT_OK" otherwise.
 *********************************************************************************************************************/
-static uart_std_error_type_t uart_stop_bit_size_select(uart_stop_bit_size_t uart_stop_bit_size)
+uart_std_error_type_t uart_rx_line_mode_enable(uint8_t* line_buffer_0, uint8_t* line_buffer_1, uint8_t line_max_length,
+                                               uint8_t terminator_set, uint8_t custom_terminator)
 {
-		uart_std_error_type_t return_error = UART_E_NOT_OK;
-		
-		switch (uart_stop_bit_size)
+	uart_std_error_type_t return_error = UART_E_NOT_OK;
+	
+	if (INITIALIZE_TO_ZERO == terminator_set)
+	{
+		/* Error: no terminator selected. */
+		return_error = UART_E_NOT_OK;
+	}
+	else
+	{
+		/* The interrupt mustn't use the buffers while they're being changed: */
+		BIT_CLEAR(UCSRB, RXCIE);
+		return_error = uart_rx_pingpong_buffers_set(line_buffer_0, line_buffer_1, line_max_length);
+		if (UART_E_OK == return_error)
 		{
-			/* Selecting 1 Stop Bit to be inserted by the Transmitter */
-			case UART_1STOP_BIT:
-			UCSRC = ((UCSRC & (~(1<<USBS))) | (1<<URSEL));
-			return_error = UART_E_OK;
-			break;
-			
-			/* Selecting 2 Stop Bits to be inserted by the Transmitter */
-			case UART_2STOP_BIT:
-			UCSRC = (UCSRC | ((1<<USBS)|(1<<URSEL)));
-			return_error = UART_E_OK;
-			break;
+			g_rx_line_terminator_set = terminator_set;
+			g_rx_line_custom_terminator = custom_terminator;
+			g_rx_mode = UART_RX_LINE_MODE;
+		}
+		BIT_SET(UCSRB, RXCIE);
+	}
+	
+	return return_error;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  uart_rx_line_ready_callback_set
+*
+** Description:
+*  This function is used to pass the address of the function that will be called when a new line is ready.
+*
+** Input Parameters:
+*  - void (*line_ready_callback)(void)
+*    Passes the address of the function that will be executed in the receive complete interrupt service routine once
+*    a complete line is handed to the application.
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+void uart_rx_line_ready_callback_set(void (*line_ready_callback)(void))
+{
+	/* Lines are frames delimited by terminators, so they share the ping-pong buffers handling: */
+	uart_rx_frame_ready_callback_set(line_ready_callback);
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  uart_rx_line_get
+*
+** Description:
+*  This function gives the application the line that is ready, if any.
+*
+** Input Parameters:
+*  - line: uint8_t**
+*    This a pointer to read back the address of the line in the caller function.
+*  - line_length: uint8_t*
+*    This a pointer to read back the number of bytes in the line in the caller function.
+*
+** Return Value:
+*  - uart_std_error_type_t
+*    The return value returns UART_E_OK if a line is ready, and returns "UART_E_NOT_OK" otherwise.
+*********************************************************************************************************************/
+uart_std_error_type_t uart_rx_line_get(uint8_t** line, uint8_t* line_length)
+{
+	return uart_rx_frame_get(line, line_length);
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  uart_rx_line_release
+*
+** Description:
+*  This function returns the line buffer taken by uart_rx_line_get back to the driver.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+void uart_rx_line_release(void)
+{
+	uart_rx_frame_release();
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  uart_rx_frame_mode_enable
+*
+** Description:
+*  This function switches the receive complete interrupt to frame operation using the two passed frame buffers as
+*  ping-pong buffers.
+*
+** Input Parameters:
+*  - frame_buffer_0: uint8_t*
+*    Passes the address of the first frame buffer array.
+*  - frame_buffer_1: uint8_t*
+*    Passes the address of the second frame buffer array.
+*  - frame_size: uint8_t
+*    Passes the size of each of the frame buffer arrays, which is also the maximum frame length.
+*
+** Return Value:
+*  - uart_std_error_type_t
+*    The return value returns UART_E_OK if the configurations are correct, and returns "UART_E_NOT_OK" otherwise.
+*********************************************************************************************************************/
+uart_std_error_type_t uart_rx_frame_mode_enable(uint8_t* frame_buffer_0, uint8_t* frame_buffer_1, uint8_t frame_size)
+{
+	uart_std_error_type_t return_error = UART_E_NOT_OK;
+	
+	/* The interrupts mustn't use the buffers while they're being changed: */
+	BIT_CLEAR(UCSRB, RXCIE);
+	BIT_CLEAR(TIMSK, OCIE0);
+	return_error = uart_rx_pingpong_buffers_set(frame_buffer_0, frame_buffer_1, frame_size);
+	if (UART_E_OK == return_error)
+	{
+		g_rx_mode = UART_RX_FRAME_MODE;
+	}
+	if (INITIALIZE_TO_ZERO != g_rx_idle_detection_enabled)
+	{
+		BIT_SET(TIMSK, OCIE0);
+	}
+	BIT_SET(UCSRB, RXCIE);
+	
+	return return_error;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  uart_rx_frame_ready_callback_set
+*
+** Description:
+*  This function is used to pass the address of the function that will be called when a new frame is ready.
+*
+** Input Parameters:
+*  - void (*frame_ready_callback)(void)
+*    Passes the address of the function that will be executed in the interrupt service routine that completes the
+*    frame.
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+void uart_rx_frame_ready_callback_set(void (*frame_ready_callback)(void))
+{
+	g_rx_pingpong_ready_callback = frame_ready_callback;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  uart_rx_frame_get
+*
+** Description:
+*  This function gives the application the frame that is ready, if any.
+*
+** Input Parameters:
+*  - frame: uint8_t**
+*    This a pointer to read back the address of the frame in the caller function.
+*  - frame_length: uint8_t*
+*    This a pointer to read back the number of bytes in the frame in the caller function.
+*
+** Return Value:
+*  - uart_std_error_type_t
+*    The return value returns UART_E_OK if a frame is ready, and returns "UART_E_NOT_OK" otherwise.
+*********************************************************************************************************************/
+uart_std_error_type_t uart_rx_frame_get(uint8_t** frame, uint8_t* frame_length)
+{
+	uart_std_error_type_t return_error = UART_E_NOT_OK;
+	
+	if (INITIALIZE_TO_ZERO != g_rx_pingpong_ready)
+	{
+		/* The ready buffer is the one the interrupt isn't filling. The interrupt doesn't swap the buffers again until
+		   the ready one is released, so the index is stable here: */
+		*frame = g_rx_pingpong_buffers[g_rx_pingpong_fill_index ^ 1U];
+		*frame_length = g_rx_pingpong_ready_length;
+		return_error = UART_E_OK;
+	}
+	
+	return return_error;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  uart_rx_frame_release
+*
+** Description:
+*  This function returns the frame buffer taken by uart_rx_frame_get back to the driver.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+void uart_rx_frame_release(void)
+{
+	g_rx_pingpong_ready = INITIALIZE_TO_ZERO;
+}
+
+
+/*********************************************************************************************************************
+                                          << Private Function Definitions >>
+*********************************************************************************************************************/
+/*********************************************************************************************************************
+Interrupt service routine definition for the UART transmit ready interrupt
+*********************************************************************************************************************/
+ISR(USART_UDRE_vect)
+{
+	if (INITIALIZE_TO_ZERO != g_tx_writev_active)
+	{
+		uart_writev_byte_send();
+	}
+	else
+	{
+		g_tx_complete_callback();
+	}
+}
+
+/*********************************************************************************************************************
+Interrupt service routine definition for the UART receive complete interrupt.
+*********************************************************************************************************************/
+ISR(USART_RXC_vect)
+{
+	uint8_t next_head = INITIALIZE_TO_ZERO;
+	
+	switch (g_rx_mode)
+	{
+		case UART_RX_BUFFERED_MODE:
+		next_head = g_rx_buffer_head + 1U;
+		if (g_rx_buffer_size == next_head)
+		{
+			next_head = INITIALIZE_TO_ZERO;
+		}
+		/* Storing the byte if the buffer isn't full, otherwise the byte is dropped: */
+		if (next_head != g_rx_buffer_tail)
+		{
+			g_rx_buffer[g_rx_buffer_head] = UDR;
+			g_rx_buffer_head = next_head;
+			g_rx_idle_frame_length++;
+		}
+		else
+		{
+			(void)UDR;
+		}
+		break;
+		
+		case UART_RX_LINE_MODE:
+		uart_rx_line_byte_store(UDR);
+		g_rx_idle_frame_length++;
+		break;
+		
+		case UART_RX_FRAME_MODE:
+		g_rx_pingpong_buffers[g_rx_pingpong_fill_index][g_rx_pingpong_fill_length] = UDR;
+		g_rx_pingpong_fill_length++;
+		g_rx_idle_frame_length++;
+		/* A full buffer completes the frame: */
+		if (g_rx_pingpong_buffer_size == g_rx_pingpong_fill_length)
+		{
+			uart_rx_pingpong_buffer_complete();
+		}
+		break;
+		
+		case UART_RX_CALLBACK_MODE:
+		default:
+		g_rx_complete_callback();
+		g_rx_idle_frame_length++;
+		break;
+	}
+	
+	if (INITIALIZE_TO_ZERO != g_rx_idle_detection_enabled)
+	{
+		uart_rx_idle_timer_restart();
+	}
+}
+
+/*********************************************************************************************************************
+Interrupt service routine definition for the Timer0 compare match interrupt, which marks the end of the idle timeout.
+*********************************************************************************************************************/
+ISR(TIMER0_COMP_vect)
+{
+	uint8_t frame_length = INITIALIZE_TO_ZERO;
+	
+	g_rx_idle_timer_periods_left--;
+	if (INITIALIZE_TO_ZERO == g_rx_idle_timer_periods_left)
+	{
+		/* The line has been idle for the whole timeout, the frame is complete: */
+		TCCR0 = TIMER0_STOPPED;
+		frame_length = g_rx_idle_frame_length;
+		g_rx_idle_frame_length = INITIALIZE_TO_ZERO;
+		/* In frame operation, the idle line completes the frame being received, unless it was completed already by
+		   filling its buffer: */
+		if ((UART_RX_FRAME_MODE == g_rx_mode) && (INITIALIZE_TO_ZERO != g_rx_pingpong_fill_length))
+		{
+			uart_rx_pingpong_buffer_complete();
+		}
+		if ((INITIALIZE_TO_ZERO != frame_length) && (NULL != g_rx_idle_callback))
+		{
+			g_rx_idle_callback(frame_length);
+		}
+	}
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  uart_character_size_select
+*
+** Description:
+*  This function configures the UART to work with the selected character size passed to it.
+*
+** Input Parameters:
+*  - uart_character_size: uart_character_size_t
+*    This parameters is used to pass user's selection of character size to the function. Different options can be 
+*    found in the specification of the datatype. 
+*
+** Return Value:
+*  - uart_std_error_type_t
+*    The return value returns UART_E_OK if the selected configuration is correct, and returns "UART_E_NOT_OK" if
+*    the selected configuration is wrong.
+*********************************************************************************************************************/
+static uart_std_error_type_t uart_character_size_select(uart_character_size_t uart_character_size)
+{
+	uart_std_error_type_t return_error = UART_E_NOT_OK;
+	
+	switch (uart_character_size)
+	{
+		/* Selecting 5-bit Character size --> UCSZ2 = 0 and UCSZ1:0 = 00 */
+		case UART_5BIT_CHARACTER_SIZE:
+		BIT_CLEAR(UCSRB, UCSZ2);
+		UCSRC = ((UCSRC & UCSZ_BITS_MASK_WITH_ZEROs) | UCSZ_5BIT_CHAR_SIZE_SELECTED | (1<<URSEL));
+		g_character_bit_count = 5;
+		return_error = UART_E_OK;
+		break;
+		
+		/* Selecting 6-bit Character size --> UCSZ2 = 0 and UCSZ1:0 = 01 */ 
+		case UART_6BIT_CHARACTER_SIZE:
+		BIT_CLEAR(UCSRB, UCSZ2);
+		UCSRC = ((UCSRC & UCSZ_BITS_MASK_WITH_ZEROs) | UCSZ_6BIT_CHAR_SIZE_SELECTED | (1<<URSEL));
+		g_character_bit_count = 6;
+		return_error = UART_E_OK;
+		break;
+		
+		/* Selecting 7-bit Character size --> UCSZ2 = 0 and UCSZ1:0 = 10 */
+		case UART_7BIT_CHARACTER_SIZE:
+		BIT_CLEAR(UCSRB, UCSZ2);
+		UCSRC = ((UCSRC & UCSZ_BITS_MASK_WITH_ZEROs) | UCSZ_7BIT_CHAR_SIZE_SELECTED | (1<<URSEL));
+		g_character_bit_count = 7;
+		return_error = UART_E_OK;
+		break;
+		
+		/* Selecting 8-bit Character size --> UCSZ2 = 0 and UCSZ1:0 = 11 */
+		case UART_8BIT_CHARACTER_SIZE:
+		BIT_CLEAR(UCSRB, UCSZ2);
+		UCSRC = ((UCSRC & UCSZ_BITS_MASK_WITH_ZEROs) | UCSZ_8BIT_CHAR_SIZE_SELECTED | (1<<URSEL));
+		g_character_bit_count = 8;
+		return_error = UART_E_OK;
+		break;
+		
+		/* Selecting 9-bit Character size --> UCSZ2 = 1 and UCSZ1:0 = 11*/
+		case UART_9BIT_CHARACTER_SIZE:
+		BIT_SET(UCSRB, UCSZ2);
+		UCSRC = ((UCSRC & UCSZ_BITS_MASK_WITH_ZEROs) | UCSZ_9BIT_CHAR_SIZE_SELECTED | (1<<URSEL));
+		g_character_bit_count = 9;
+		return_error = UART_E_OK;
+		break;
+		
+		/* Error: Wrong configurations */
+		default:
+		return_error = UART_E_NOT_OK;
+		break;
+	}
+	
+	return return_error;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  uart_stop_bit_size_select
+*
+** Description:
+*  This function configures the UART to work with the selected stop bit size passed to it.
+*
+** Input Parameters:
+*  - uart_stop_bit_size: uart_stop_bit_size_t
+*    This parameters is used to pass the stop bit size selection to the function.
+*
+** Return Value:
+*  - uart_std_error_type_t
+*    The return value returns UART_E_OK if the selected configuration is correct, and returns "UART_E_NOT_OK" if
+*    the selected configuration is wrong.
+*********************************************************************************************************************/
+static uart_std_error_type_t uart_stop_bit_size_select(uart_stop_bit_size_t uart_stop_bit_size)
+{
+		uart_std_error_type_t return_error = UART_E_NOT_OK;
+		
+		switch (uart_stop_bit_size)
+		{
+			/* Selecting 1 Stop Bit to be inserted by the Transmitter */
+			case UART_1STOP_BIT:
+			UCSRC = ((UCSRC & (~(1<<USBS))) | (1<<URSEL));
+			g_stop_bit_count = 1;
+			return_error = UART_E_OK;
+			break;
+			
+			/* Selecting 2 Stop Bits to be inserted by the Transmitter */
+			case UART_2STOP_BIT:
+			UCSRC = (UCSRC | ((1<<USBS)|(1<<URSEL)));
+			g_stop_bit_count = 2;
+			return_error = UART_E_OK;
+			break;
 			
 			/* error: wrong configuration. */
 			default:
@@ -686,6 +1442,238 @@ static uart_std_error_type_t uart_stop_bit_size_select(uart_stop_bit_size_t uart
 		return return_error;
 }
 
+/*********************************************************************************************************************
+** Function Name:
+*  uart_rx_idle_timer_restart
+*
+** Description:
+*  This function restarts the idle timeout from zero. It's called from the receive complete interrupt service routine
+*  on every received byte.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+static void uart_rx_idle_timer_restart(void)
+{
+	TCNT0 = INITIALIZE_TO_ZERO;
+	TIFR = (1<<OCF0);  /* Clearing a pending compare match by writing one to its flag */
+	g_rx_idle_timer_periods_left = g_rx_idle_timer_periods;
+	TCCR0 = (TIMER0_CTC_MODE | g_rx_idle_timer_clock_select);
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  uart_rx_line_byte_store
+*
+** Description:
+*  This function assembles the received bytes into lines. It's called from the receive complete interrupt service 
+*  routine in line assembly operation.
+*
+** Input Parameters:
+*  - data_byte: uint8_t
+*    Passes the received byte.
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+static void uart_rx_line_byte_store(uint8_t data_byte)
+{
+	uint8_t terminator_set = g_rx_line_terminator_set;
+	
+	if (((ASCII_LF == data_byte) && (terminator_set & UART_LINE_TERMINATOR_LF)) ||
+	    ((ASCII_CR == data_byte) && (terminator_set & UART_LINE_TERMINATOR_CR)) ||
+	    ((g_rx_line_custom_terminator == data_byte) && (terminator_set & UART_LINE_TERMINATOR_CUSTOM)))
+	{
+		/* End of line. Empty lines aren't reported: */
+		if (INITIALIZE_TO_ZERO != g_rx_pingpong_fill_length)
+		{
+			uart_rx_pingpong_buffer_complete();
+		}
+	}
+	else
+	{
+		g_rx_pingpong_buffers[g_rx_pingpong_fill_index][g_rx_pingpong_fill_length] = data_byte;
+		g_rx_pingpong_fill_length++;
+		/* A line reaching the maximum length is reported as is: */
+		if (g_rx_pingpong_buffer_size == g_rx_pingpong_fill_length)
+		{
+			uart_rx_pingpong_buffer_complete();
+		}
+	}
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  uart_rx_pingpong_buffer_complete
+*
+** Description:
+*  This function hands the buffer being filled to the application and swaps the ping-pong buffers. If the application 
+*  still owns the other buffer, there's nowhere to continue, so the completed data is dropped instead.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+static void uart_rx_pingpong_buffer_complete(void)
+{
+	if (INITIALIZE_TO_ZERO == g_rx_pingpong_ready)
+	{
+		g_rx_pingpong_ready_length = g_rx_pingpong_fill_length;
+		g_rx_pingpong_fill_index ^= 1U;
+		g_rx_pingpong_ready = 1U;
+		if (NULL != g_rx_pingpong_ready_callback)
+		{
+			g_rx_pingpong_ready_callback();
+		}
+	}
+	/* Start filling from the beginning of the buffer the interrupt now owns: */
+	g_rx_pingpong_fill_length = INITIALIZE_TO_ZERO;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  uart_rx_pingpong_buffers_set
+*
+** Description:
+*  This function sets the two ping-pong buffers used by the line and frame operations, and resets their state. The
+*  caller needs to disable the interrupts using the buffers first.
+*
+** Input Parameters:
+*  - buffer_0: uint8_t*
+*    Passes the address of the first buffer array.
+*  - buffer_1: uint8_t*
+*    Passes the address of the second buffer array.
+*  - buffer_size: uint8_t
+*    Passes the size of each of the buffer arrays.
+*
+** Return Value:
+*  - uart_std_error_type_t
+*    The return value returns UART_E_OK if the buffers are valid, and returns "UART_E_NOT_OK" otherwise.
+*********************************************************************************************************************/
+static uart_std_error_type_t uart_rx_pingpong_buffers_set(uint8_t* buffer_0, uint8_t* buffer_1, uint8_t buffer_size)
+{
+	uart_std_error_type_t return_error = UART_E_NOT_OK;
+	
+	if ((NULL == buffer_0) || (NULL == buffer_1) || (INITIALIZE_TO_ZERO == buffer_size))
+	{
+		/* Error: wrong configuration. */
+		return_error = UART_E_NOT_OK;
+	}
+	else
+	{
+		g_rx_pingpong_buffers[0] = buffer_0;
+		g_rx_pingpong_buffers[1] = buffer_1;
+		g_rx_pingpong_buffer_size = buffer_size;
+		g_rx_pingpong_fill_index = INITIALIZE_TO_ZERO;
+		g_rx_pingpong_fill_length = INITIALIZE_TO_ZERO;
+		g_rx_pingpong_ready = INITIALIZE_TO_ZERO;
+		g_rx_pingpong_ready_length = INITIALIZE_TO_ZERO;
+		return_error = UART_E_OK;
+	}
+	
+	return return_error;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  uart_writev_iovec_load
+*
+** Description:
+*  This function loads the next descriptor that has data to transmit, skipping empty ones. For CRC-16 descriptors, 
+*  the running CRC is captured at this point, so it covers all the bytes transmitted before it.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - uint8_t
+*    Returns 1 if a descriptor with data was loaded, and 0 if there are no descriptors left.
+*********************************************************************************************************************/
+static uint8_t uart_writev_iovec_load(void)
+{
+	uint8_t return_value = INITIALIZE_TO_ZERO;
+	
+	g_tx_data_left = INITIALIZE_TO_ZERO;
+	while ((INITIALIZE_TO_ZERO == g_tx_data_left) && (INITIALIZE_TO_ZERO != g_tx_iovec_left))
+	{
+		g_tx_data_flags = g_tx_iovec->flags;
+		if (g_tx_data_flags & UART_IOVEC_CRC16)
+		{
+			g_tx_crc_bytes[0] = (uint8_t)g_tx_crc;
+			g_tx_crc_bytes[1] = (uint8_t)(g_tx_crc >> SHIFT_BY_EIGHT);
+			g_tx_data = g_tx_crc_bytes;
+			g_tx_data_left = CRC16_SIZE;
+		}
+		else
+		{
+			g_tx_data = g_tx_iovec->data;
+			g_tx_data_left = g_tx_iovec->length;
+		}
+		g_tx_iovec++;
+		g_tx_iovec_left--;
+	}
+	
+	if (INITIALIZE_TO_ZERO != g_tx_data_left)
+	{
+		return_value = 1U;
+	}
+	
+	return return_value;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  uart_writev_byte_send
+*
+** Description:
+*  This function transmits the next byte of a uart_writev transmission. It's called from the data register empty 
+*  interrupt service routine, and it ends the transmission once all the descriptors are transmitted.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+static void uart_writev_byte_send(void)
+{
+	uint8_t data_byte = INITIALIZE_TO_ZERO;
+	
+	if (g_tx_data_flags & UART_IOVEC_PROGMEM)
+	{
+		data_byte = pgm_read_byte(g_tx_data);
+	}
+	else
+	{
+		data_byte = *g_tx_data;
+	}
+	UDR = data_byte;
+	g_tx_data++;
+	g_tx_data_left--;
+	
+	/* The CRC bytes themselves aren't part of the running CRC: */
+	if (!(g_tx_data_flags & UART_IOVEC_CRC16))
+	{
+		g_tx_crc = _crc16_update(g_tx_crc, data_byte);
+	}
+	
+	if ((INITIALIZE_TO_ZERO == g_tx_data_left) && (INITIALIZE_TO_ZERO == uart_writev_iovec_load()))
+	{
+		/* All the descriptors are transmitted: */
+		BIT_CLEAR(UCSRB, UDRIE);
+		g_tx_writev_active = INITIALIZE_TO_ZERO;
+		if (NULL != g_tx_writev_complete_callback)
+		{
+			g_tx_writev_complete_callback();
+		}
+	}
+}
+
 /*********************************************************************************************************************
                                                 << End of File >>
 *********************************************************************************************************************/
\ No newline at end of file
@@ -37,6 +37,19 @@
 /*********************************************************************************************************************
                                                << Public Constants >>
 *********************************************************************************************************************/
+/* Number of character times the receive line has to stay idle before the idle-line event is reported: */
+#define   UART_RX_IDLE_TIMEOUT_CHARACTERS   (3U)
+
+/* Line terminator options of the line assembly mode. They can be combined, for example:
+   (UART_LINE_TERMINATOR_LF | UART_LINE_TERMINATOR_CR) */
+#define   UART_LINE_TERMINATOR_LF           (0x01U)   /* '\n' */
+#define   UART_LINE_TERMINATOR_CR           (0x02U)   /* '\r' */
+#define   UART_LINE_TERMINATOR_CUSTOM       (0x04U)   /* The custom terminator byte passed to the driver */
+
+/* Scatter-gather transmit descriptor flags (see uart_iovec_t): */
+#define   UART_IOVEC_RAM                    (0x00U)   /* The data lives in SRAM */
+#define   UART_IOVEC_PROGMEM                (0x01U)   /* The data lives in flash (PROGMEM) */
+#define   UART_IOVEC_CRC16                  (0x02U)   /* Transmit the running CRC-16 instead of data */
 
 
 /*********************************************************************************************************************
@@ -88,6 +101,40 @@ typedef enum
 	UART_CLOCK_POLARITY_0 = 0,
 	UART_CLOCK_POLARITY_1
 	}uart_clock_polarity_t;
+
+/*********************************************************************************************************************
+** Datatype Name:
+*  uart_iovec_t
+*
+** Description:
+*  This is a structure datatype that describes one part of a frame transmitted by uart_writev, for example the header,
+*  the payload, or the trailer. The data is transmitted directly from where it lives, so it needs to stay unchanged 
+*  until the transmission is complete.
+*
+** Datatype Elements:
+*  [1] data: const uint8_t*
+*      This is a pointer to the data of this part of the frame. It's ignored for UART_IOVEC_CRC16 descriptors.
+*  [2] length: uint16_t
+*      This element holds the number of bytes of this part of the frame. It's ignored for UART_IOVEC_CRC16 descriptors.
+*  [3] flags: uint8_t
+*      UART_IOVEC_RAM if the data lives in SRAM, UART_IOVEC_PROGMEM if the data lives in flash, or UART_IOVEC_CRC16 to
+*      transmit the CRC-16 (polynomial 0xA001, initial value 0xFFFF, as in Modbus) of all the bytes transmitted before
+*      it in the same uart_writev call. The CRC is transmitted low byte first.
+*
+** Use Example:
+*  [1] Transmit a header from SRAM, a payload from flash, then the CRC of both:
+*      static const uint8_t payload[] PROGMEM = {...};
+*      static const uart_iovec_t frame[] = {{header, sizeof(header), UART_IOVEC_RAM},
+*                                           {payload, sizeof(payload), UART_IOVEC_PROGMEM},
+*                                           {NULL, 0, UART_IOVEC_CRC16}};
+*      uart_writev(frame, 3);
+*********************************************************************************************************************/
+typedef struct
+{
+	const uint8_t* data;
+	uint16_t length;
+	uint8_t flags;
+} uart_iovec_t;
 /*********************************************************************************************************************
                                            << Public Function Declarations >>
 *********************************************************************************************************************/
@@ -314,6 +361,94 @@ extern uart_is_ready_t uart_transmitter_is_ready(void);
 extern void uart_data_write(uint8_t data_byte);
 
 
+/*********************************************************************************************************************
+** Function Name:
+*  uart_writev
+*
+** Description:
+*  This function starts the transmission of a frame made of several parts (scatter-gather transmission). The data 
+*  register empty interrupt walks the descriptors and transmits the data directly from SRAM or flash, so the parts 
+*  don't need to be copied into one buffer first. The function returns immediately.
+*  The transmitter needs to be enabled, and the global interrupts need to be enabled. The data register empty
+*  interrupt is shared with the transmit complete callback, so the transmission is refused while the transmit
+*  complete interrupt is enabled, and uart_transmit_complete_interrupt_enable must not be called until it's complete,
+*  as the interrupt is disabled again at its end.
+*
+** Input Parameters:
+*  - iovec: const uart_iovec_t*
+*    Passes the address of the array of descriptors. The array needs to stay unchanged until the transmission is 
+*    complete.
+*  - iovec_count: uint8_t
+*    Passes the number of descriptors in the array.
+*
+** Return Value:
+*  - uart_std_error_type_t
+*    The return value returns UART_E_OK if the transmission started, and returns "UART_E_NOT_OK" if the descriptors
+*    are wrong, a previous transmission is still in progress, or the transmit complete interrupt is enabled.
+*********************************************************************************************************************/
+extern uart_std_error_type_t uart_writev(const uart_iovec_t* iovec, uint8_t iovec_count);
+
+
+/*********************************************************************************************************************
+** Function Name:
+*  uart_writev_is_ready
+*
+** Description:
+*  This function returns whether a new uart_writev transmission can be started.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - uart_is_ready_t
+*    Returns "UART_READY" if no uart_writev transmission is in progress, and "UART_NOT_READY" otherwise.
+*********************************************************************************************************************/
+extern uart_is_ready_t uart_writev_is_ready(void);
+
+
+/*********************************************************************************************************************
+** Function Name:
+*  uart_writev_complete_callback_set
+*
+** Description:
+*  This function is used to pass the address of the function that will be called once the last byte of a uart_writev
+*  transmission is written to the UART data register.
+*
+** Input Parameters:
+*  - void (*writev_complete_callback)(void)
+*    Passes the address of the function that will be executed in the data register empty interrupt service routine.
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+extern void uart_writev_complete_callback_set(void (*writev_complete_callback)(void));
+
+
+/*********************************************************************************************************************
+** Function Name:
+*  uart_write_P
+*
+** Description:
+*  This function starts the transmission of a null-terminated string that lives in flash (PROGMEM), like banners and 
+*  help texts. The data register empty interrupt reads the string directly from flash, so it doesn't need to be copied
+*  to SRAM. The function returns immediately, and it works the same as uart_writev with one UART_IOVEC_PROGMEM 
+*  descriptor, so uart_writev_is_ready and the uart_writev complete callback apply to it as well.
+*
+** Input Parameters:
+*  - string_P: const char*
+*    Passes the address of the string in flash.
+*
+** Return Value:
+*  - uart_std_error_type_t
+*    The return value returns UART_E_OK if the transmission started, and returns "UART_E_NOT_OK" if the string address
+*    is wrong, a previous transmission is still in progress, or the transmit complete interrupt is enabled.
+*
+** Use Example:
+*  uart_write_P(PSTR("Type 'help' for the list of commands.\r\n"));
+*********************************************************************************************************************/
+extern uart_std_error_type_t uart_write_P(const char* string_P);
+
+
 /*********************************************************************************************************************
 ** Function Name:
 *  uart_receiver_enable
@@ -438,6 +573,314 @@ extern uart_is_ready_t uart_receiver_is_ready(void);
 extern uint8_t uart_data_read(void);
 
 
+/*********************************************************************************************************************
+** Function Name:
+*  uart_rx_buffer_config
+*
+** Description:
+*  This function switches the receive complete interrupt to buffered operation. Instead of calling the receive complete
+*  callback for every byte, the interrupt service routine stores the received bytes in the passed ring buffer, and the
+*  application reads them later using uart_rx_buffer_read. The receive complete interrupt needs to be enabled.
+*  Note that one location of the buffer is always kept empty, so the buffer holds up to (rx_buffer_size - 1) bytes, and
+*  bytes received while the buffer is full are dropped.
+*
+** Input Parameters:
+*  - rx_buffer: uint8_t*
+*    Passes the address of the array that will be used as the receive ring buffer.
+*  - rx_buffer_size: uint8_t
+*    Passes the size of the receive ring buffer array. It needs to be 2 or more.
+*
+** Return Value:
+*  - uart_std_error_type_t
+*    The return value returns UART_E_OK if the buffer is valid, and returns "UART_E_NOT_OK" otherwise.
+*
+** Use Example:
+*  static uint8_t uart_rx_data_buffer[32];
+*  uart_rx_buffer_config(uart_rx_data_buffer, sizeof(uart_rx_data_buffer));
+*********************************************************************************************************************/
+extern uart_std_error_type_t uart_rx_buffer_config(uint8_t* rx_buffer, uint8_t rx_buffer_size);
+
+
+/*********************************************************************************************************************
+** Function Name:
+*  uart_rx_buffer_read
+*
+** Description:
+*  This function reads the oldest byte from the receive ring buffer.
+*
+** Input Parameters:
+*  - data_byte: uint8_t*
+*    This a pointer to read back the received byte in the caller function. If the buffer is empty, the variable won't
+*    be changed by the function.
+*
+** Return Value:
+*  - uart_std_error_type_t
+*    The return value returns UART_E_OK if a byte was read, and returns "UART_E_NOT_OK" if the buffer is empty.
+*********************************************************************************************************************/
+extern uart_std_error_type_t uart_rx_buffer_read(uint8_t* data_byte);
+
+
+/*********************************************************************************************************************
+** Function Name:
+*  uart_rx_buffer_count
+*
+** Description:
+*  This function returns the number of received bytes waiting in the receive ring buffer.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - uint8_t
+*    Returns the number of bytes that can be read from the receive ring buffer.
+*********************************************************************************************************************/
+extern uint8_t uart_rx_buffer_count(void);
+
+
+/*********************************************************************************************************************
+** Function Name:
+*  uart_rx_idle_detection_enable
+*
+** Description:
+*  This function enables the idle-line event, which is used to delimit frames of protocols that don't have delimiters.
+*  Timer0 is restarted on every received byte, and once the receive line stays idle for UART_RX_IDLE_TIMEOUT_CHARACTERS
+*  character times, the callback is called once with the number of bytes received since the previous event.
+*  The timeout is calculated from the current baud rate and frame format settings, so this function needs to be called
+*  after uart_baud_rate_config, uart_frame_format_select, and uart_parity_mode_select, and called again if any of them
+*  is changed.
+*  In frame operation (see uart_rx_frame_mode_enable), the idle-line event also completes the frame being received.
+*  Note that this function uses Timer0 and its compare match interrupt, so Timer0 can't be used by the application.
+*
+** Input Parameters:
+*  - rx_idle_callback: void (*)(uint8_t frame_length)
+*    Passes the address of the function that will be executed in the Timer0 interrupt service routine once the line
+*    becomes idle. The length of the completed frame is passed to it, and its bytes can be read from the receive ring
+*    buffer. NULL can be passed if no callback is needed, for example in frame operation.
+*
+** Return Value:
+*  - uart_std_error_type_t
+*    The return value returns UART_E_OK if the timeout fits Timer0, and returns "UART_E_NOT_OK" otherwise.
+*********************************************************************************************************************/
+extern uart_std_error_type_t uart_rx_idle_detection_enable(void (*rx_idle_callback)(uint8_t frame_length));
+
+
+/*********************************************************************************************************************
+** Function Name:
+*  uart_rx_idle_detection_disable
+*
+** Description:
+*  This function disables the idle-line event and stops Timer0.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+extern void uart_rx_idle_detection_disable(void);
+
+
+/*********************************************************************************************************************
+** Function Name:
+*  uart_rx_line_mode_enable
+*
+** Description:
+*  This function switches the receive complete interrupt to line assembly operation. The interrupt service routine
+*  compares every received byte against the selected terminators and stores the other bytes in one of two line 
+*  buffers (ping-pong buffers). Once a terminator is received, or the line reaches its maximum length, the line is 
+*  handed to the application and the interrupt continues filling the other buffer. This way the application only
+*  wakes up for complete lines instead of every character.
+*  Terminators aren't stored in the line, and empty lines (for example, the '\n' of a "\r\n" pair) aren't reported.
+*  If a line completes while the application still owns the previous one, the new line is dropped.
+*  The receive complete interrupt needs to be enabled.
+*
+** Input Parameters:
+*  - line_buffer_0: uint8_t*
+*    Passes the address of the first line buffer array.
+*  - line_buffer_1: uint8_t*
+*    Passes the address of the second line buffer array.
+*  - line_max_length: uint8_t
+*    Passes the size of each of the line buffer arrays, which is also the maximum line length.
+*  - terminator_set: uint8_t
+*    Passes the selected terminators. For example: (UART_LINE_TERMINATOR_LF | UART_LINE_TERMINATOR_CR).
+*  - custom_terminator: uint8_t
+*    Passes the custom terminator byte, used only if UART_LINE_TERMINATOR_CUSTOM is selected.
+*
+** Return Value:
+*  - uart_std_error_type_t
+*    The return value returns UART_E_OK if the configurations are correct, and returns "UART_E_NOT_OK" otherwise.
+*
+** Use Example:
+*  static uint8_t line_buffers[2][32];
+*  uart_rx_line_mode_enable(line_buffers[0], line_buffers[1], 32, (UART_LINE_TERMINATOR_LF|UART_LINE_TERMINATOR_CR), 0);
+*********************************************************************************************************************/
+extern uart_std_error_type_t uart_rx_line_mode_enable(uint8_t* line_buffer_0, uint8_t* line_buffer_1, 
+                                                      uint8_t line_max_length, uint8_t terminator_set, 
+                                                      uint8_t custom_terminator);
+
+
+/*********************************************************************************************************************
+** Function Name:
+*  uart_rx_line_ready_callback_set
+*
+** Description:
+*  This function is used to pass the address of the function that will be called when a new line is ready.
+*
+** Input Parameters:
+*  - void (*line_ready_callback)(void)
+*    Passes the address of the function that will be executed in the receive complete interrupt service routine once
+*    a complete line is handed to the application.
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+extern void uart_rx_line_ready_callback_set(void (*line_ready_callback)(void));
+
+
+/*********************************************************************************************************************
+** Function Name:
+*  uart_rx_line_get
+*
+** Description:
+*  This function gives the application the line that is ready, if any. The line is parsed in place, and it stays owned
+*  by the application until uart_rx_line_release is called.
+*
+** Input Parameters:
+*  - line: uint8_t**
+*    This a pointer to read back the address of the line in the caller function.
+*  - line_length: uint8_t*
+*    This a pointer to read back the number of bytes in the line in the caller function.
+*
+** Return Value:
+*  - uart_std_error_type_t
+*    The return value returns UART_E_OK if a line is ready, and returns "UART_E_NOT_OK" otherwise.
+*
+** Use Example:
+*  uint8_t* line;
+*  uint8_t line_length;
+*  if (UART_E_OK == uart_rx_line_get(&line, &line_length))
+*  {
+*      //Process the line
+*      uart_rx_line_release();
+*  }
+*********************************************************************************************************************/
+extern uart_std_error_type_t uart_rx_line_get(uint8_t** line, uint8_t* line_length);
+
+
+/*********************************************************************************************************************
+** Function Name:
+*  uart_rx_line_release
+*
+** Description:
+*  This function returns the line buffer taken by uart_rx_line_get back to the driver.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+extern void uart_rx_line_release(void);
+
+
+/*********************************************************************************************************************
+** Function Name:
+*  uart_rx_frame_mode_enable
+*
+** Description:
+*  This function switches the receive complete interrupt to frame operation using two fixed-size frame buffers
+*  (ping-pong buffers). The interrupt service routine fills one buffer while the application owns the other one, and
+*  the ownership flips once a frame is complete. A frame is complete when its buffer is full, or when the line becomes
+*  idle if the idle-line event is enabled using uart_rx_idle_detection_enable. The application parses the frame in 
+*  place, so no per-byte reads or copies are needed.
+*  If a frame completes while the application still owns the previous one, the new frame is dropped.
+*  The receive complete interrupt needs to be enabled.
+*
+** Input Parameters:
+*  - frame_buffer_0: uint8_t*
+*    Passes the address of the first frame buffer array.
+*  - frame_buffer_1: uint8_t*
+*    Passes the address of the second frame buffer array.
+*  - frame_size: uint8_t
+*    Passes the size of each of the frame buffer arrays, which is also the maximum frame length.
+*
+** Return Value:
+*  - uart_std_error_type_t
+*    The return value returns UART_E_OK if the configurations are correct, and returns "UART_E_NOT_OK" otherwise.
+*
+** Use Example:
+*  static uint8_t frame_buffers[2][16];
+*  uart_rx_frame_mode_enable(frame_buffers[0], frame_buffers[1], 16);
+*  uart_rx_idle_detection_enable(NULL);
+*********************************************************************************************************************/
+extern uart_std_error_type_t uart_rx_frame_mode_enable(uint8_t* frame_buffer_0, uint8_t* frame_buffer_1, 
+                                                       uint8_t frame_size);
+
+
+/*********************************************************************************************************************
+** Function Name:
+*  uart_rx_frame_ready_callback_set
+*
+** Description:
+*  This function is used to pass the address of the function that will be called when a new frame is ready.
+*
+** Input Parameters:
+*  - void (*frame_ready_callback)(void)
+*    Passes the address of the function that will be executed in the interrupt service routine that completes the
+*    frame, which is either the receive complete or the Timer0 compare match interrupt.
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+extern void uart_rx_frame_ready_callback_set(void (*frame_ready_callback)(void));
+
+
+/*********************************************************************************************************************
+** Function Name:
+*  uart_rx_frame_get
+*
+** Description:
+*  This function gives the application the frame that is ready, if any. The frame is parsed in place, and it stays 
+*  owned by the application until uart_rx_frame_release is called.
+*
+** Input Parameters:
+*  - frame: uint8_t**
+*    This a pointer to read back the address of the frame in the caller function.
+*  - frame_length: uint8_t*
+*    This a pointer to read back the number of bytes in the frame in the caller function.
+*
+** Return Value:
+*  - uart_std_error_type_t
+*    The return value returns UART_E_OK if a frame is ready, and returns "UART_E_NOT_OK" otherwise.
+*
+** Use Example:
+*  uint8_t* frame;
+*  uint8_t frame_length;
+*  if (UART_E_OK == uart_rx_frame_get(&frame, &frame_length))
+*  {
+*      //Process the frame
+*      uart_rx_frame_release();
+*  }
+*********************************************************************************************************************/
+extern uart_std_error_type_t uart_rx_frame_get(uint8_t** frame, uint8_t* frame_length);
+
+
+/*********************************************************************************************************************
+** Function Name:
+*  uart_rx_frame_release
+*
+** Description:
+*  This function returns the frame buffer taken by uart_rx_frame_get back to the driver.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+extern void uart_rx_frame_release(void);
+
+
 #endif /* UART_ATMEGA32_H_ */ 
 /*********************************************************************************************************************
                                                     << End of File >>
@@ -34,6 +34,7 @@
                                                << File Inclusions >>
 *********************************************************************************************************************/
 #include <stdint.h>
+#include <util/atomic.h>
 
 /*********************************************************************************************************************
                                                << Public Data Types >>
@@ -77,6 +78,15 @@ typedef enum{
 /*********************************************************************************************************************
                                                << Public Constants >>
 *********************************************************************************************************************/
+/* The PORT, DDR and PIN registers of the four ports are evenly spaced (PORTA at 0x3B, PORTB at 0x38, ...). These are 
+   used by the inline functions below to turn a constant port into a fixed register address: */
+#define   GPIO_PORT_REG(GPIO_PORT)   (*((volatile uint8_t*)(uintptr_t)(0x3BU - (3U * (uint8_t)(GPIO_PORT)))))
+#define   GPIO_DDR_REG(GPIO_PORT)    (*((volatile uint8_t*)(uintptr_t)(0x3AU - (3U * (uint8_t)(GPIO_PORT)))))
+#define   GPIO_PIN_REG(GPIO_PORT)    (*((volatile uint8_t*)(uintptr_t)(0x39U - (3U * (uint8_t)(GPIO_PORT)))))
+
+/* True for a constant mask of a single pin, which the inline functions below change with a single sbi or cbi: */
+#define   GPIO_IS_SINGLE_PIN_MASK(GPIO_PINS)   (__builtin_constant_p(GPIO_PINS) && (0U != (GPIO_PINS)) && \
+                                                (0U == ((GPIO_PINS) & ((GPIO_PINS) - 1U))))
 
 
 /*********************************************************************************************************************
@@ -133,6 +143,8 @@ extern gpio_std_return_error_t gpio_port_config(gpio_port_t gpio_port, gpio_dire
 *  The following function is used to initialize a group of pins as input or output. In case of setting the pins as
 *  output, the init value sets the initial state of the port pins to HIGH or LOW. And in case of setting the port
 *  as  input, init value can be used to set pull-up resistors.
+*  Interrupts are disabled while the registers are changed, so the function can be used on a port, of which other
+*  pins are changed by an interrupt.
 *
 ** Input Parameters:
 *  - gpio_port: gpio_port_t
@@ -247,6 +259,8 @@ extern gpio_std_return_error_t gpio_port_write(gpio_port_t gpio_port, uint8_t gp
 *  The following function is used to output certain values  on a group of selected pins of a certain  port in case the
 *  port is set as output, or to enable/disable the pull-up resistors on the selected pins in case the port is set as 
 *  input.
+*  Interrupts are disabled while the port is changed, so the function can be used on a port, of which other pins are
+*  changed by an interrupt.
 *
 ** Input Parameters:
 *  - gpio_port: gpio_port_t
@@ -279,7 +293,7 @@ extern gpio_std_return_error_t gpio_port_write(gpio_port_t gpio_port, uint8_t gp
 *      if(GPIO_E_OK != return_error)
 *      { //Report error}
 *********************************************************************************************************************/
-extern gpio_std_return_error_t gpio_pins_write(gpio_port_t gpio_port, gpio_pin_t gpio_pins, uint8_t gpio_pins_value);
+extern gpio_std_return_error_t gpio_pins_write(gpio_port_t gpio_port, uint8_t gpio_pins, uint8_t gpio_pins_value);
 
 
 /*********************************************************************************************************************
@@ -321,6 +335,32 @@ extern gpio_std_return_error_t gpio_pin_write(gpio_port_t gpio_port, gpio_pin_t
                                               gpio_pin_level_t gpio_pin_level);
 
 
+/*********************************************************************************************************************
+** Function Name:
+*  gpio_pin_toggle
+*
+** Description:
+*  The following function is used to invert the output level of a selected pin of a certain port in case the pin is 
+*  configured as output, or to enable/disable its pull-up resistor in case the pin is configured as input. 
+*  Interrupts are disabled while the port is changed.
+*
+** Input Parameters:
+*  - gpio_port: gpio_port_t
+*    This parameter is used to pass the certain port to which the pin belongs to the function. Example: GPIO_PORTA.
+*  - gpio_pin: gpio_pin_t
+*    This parameter passes the selected pin to the function. Example: GPIO_PIN3.
+*
+** Return Value:
+*  - gpio_std_return_error_t
+*    Returns 'GPIO_E_OK' for correct port and pin, and 'GPIO_E_NOT_OK' if any of them is wrong.
+*
+** Use Examples:
+*  [1] Blink an LED on PIN 0 of PORT B, which is configured as output:
+*      gpio_pin_toggle(GPIO_PORTB, GPIO_PIN0);
+*********************************************************************************************************************/
+extern gpio_std_return_error_t gpio_pin_toggle(gpio_port_t gpio_port, gpio_pin_t gpio_pin);
+
+
 /*********************************************************************************************************************
 ** Function Name:
 *  gpio_port_read
@@ -383,7 +423,7 @@ extern gpio_std_return_error_t gpio_port_read(gpio_port_t gpio_port, uint8_t* gp
 *      if(GPIO_E_OK != return_error)
 *      { //Report error}
 *********************************************************************************************************************/
-extern gpio_std_return_error_t gpio_pins_read(gpio_port_t gpio_port, gpio_pin_t gpio_pins, uint8_t* gpio_pins_value);
+extern gpio_std_return_error_t gpio_pins_read(gpio_port_t gpio_port, uint8_t gpio_pins, uint8_t* gpio_pins_value);
 
 
 
@@ -419,6 +459,270 @@ extern gpio_std_return_error_t gpio_pins_read(gpio_port_t gpio_port, gpio_pin_t
 *********************************************************************************************************************/
 extern gpio_std_return_error_t gpio_pin_read(gpio_port_t gpio_port, gpio_pin_t gpio_pin, gpio_pin_level_t* pin_level);
 
+/*********************************************************************************************************************
+                                    << Inline Functions (Compile-Time Access Layer) >>
+*********************************************************************************************************************/
+/*********************************************************************************************************************
+** Inline functions:
+*  The following functions do the same as the functions above, but they're inlined in the caller. When the port and 
+*  the pin are constants, which is the usual case for pins wired to a device, the compiler resolves them to a fixed
+*  register and the access compiles to a single sbi, cbi, out, or sbis/sbic instruction instead of a function call and
+*  a switch over the ports. Otherwise, they call the functions above. The code needs to be compiled with optimization
+*  enabled, which is the default for release builds.
+*  All of them are safe to use on a port, of which other pins are changed by an interrupt: a single pin is changed
+*  with sbi or cbi, which can't be interrupted, and a group of pins is changed with interrupts disabled for the few
+*  cycles of the read-modify-write.
+*********************************************************************************************************************/
+/*********************************************************************************************************************
+** Function Name:
+*  gpio_pin_write_fast
+*
+** Description:
+*  Inline version of gpio_pin_write(). The level doesn't need to be a constant.
+*
+** Input Parameters:
+*  - gpio_port: gpio_port_t
+*    Passes the port, to which the pin belongs. Example: GPIO_PORTA.
+*  - gpio_pin: gpio_pin_t
+*    Passes the pin. Example: GPIO_PIN5
+*  - gpio_pin_level: gpio_pin_level_t
+*    Passes GPIO_PIN_HIGH or GPIO_PIN_LOW.
+*
+** Return Value:
+*  - void
+*
+** Use Example:
+*  gpio_pin_write_fast(GPIO_PORTB, GPIO_PIN2, GPIO_PIN_HIGH);   // Compiles to: sbi PORTB, 2
+*********************************************************************************************************************/
+static inline __attribute__((always_inline)) void gpio_pin_write_fast(gpio_port_t gpio_port, gpio_pin_t gpio_pin, 
+                                                                       gpio_pin_level_t gpio_pin_level)
+{
+	if (__builtin_constant_p(gpio_port) && __builtin_constant_p(gpio_pin) && (GPIO_PORTD >= gpio_port))
+	{
+		if (GPIO_PIN_LOW != gpio_pin_level)
+		{
+			GPIO_PORT_REG(gpio_port) |= (uint8_t)(1U << gpio_pin);
+		}
+		else
+		{
+			GPIO_PORT_REG(gpio_port) &= (uint8_t)(~(1U << gpio_pin));
+		}
+	}
+	else
+	{
+		(void)gpio_pin_write(gpio_port, gpio_pin, gpio_pin_level);
+	}
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  gpio_pins_write_fast
+*
+** Description:
+*  Inline version of gpio_pins_write(). A constant mask of a single pin is written with sbi or cbi, and any other mask 
+*  with a read-modify-write of the port with interrupts disabled.
+*
+** Input Parameters:
+*  - gpio_port: gpio_port_t
+*    Passes the port. Example: GPIO_PORTA.
+*  - gpio_pins: uint8_t
+*    Passes the mask of the pins to write. Example: ((1<<GPIO_PIN4)|(1<<GPIO_PIN5))
+*  - gpio_pins_value: uint8_t
+*    Passes the values of the pins, at the same bit positions as the mask.
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+static inline __attribute__((always_inline)) void gpio_pins_write_fast(gpio_port_t gpio_port, uint8_t gpio_pins, 
+                                                                        uint8_t gpio_pins_value)
+{
+	if (__builtin_constant_p(gpio_port) && (GPIO_PORTD >= gpio_port) && GPIO_IS_SINGLE_PIN_MASK(gpio_pins))
+	{
+		if (0 != (gpio_pins & gpio_pins_value))
+		{
+			GPIO_PORT_REG(gpio_port) |= gpio_pins;
+		}
+		else
+		{
+			GPIO_PORT_REG(gpio_port) &= (uint8_t)(~gpio_pins);
+		}
+	}
+	else if (__builtin_constant_p(gpio_port) && (GPIO_PORTD >= gpio_port))
+	{
+		ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+		{
+			GPIO_PORT_REG(gpio_port) = (GPIO_PORT_REG(gpio_port) & (uint8_t)(~gpio_pins)) | (gpio_pins & gpio_pins_value);
+		}
+	}
+	else
+	{
+		(void)gpio_pins_write(gpio_port, gpio_pins, gpio_pins_value);
+	}
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  gpio_port_write_fast
+*
+** Description:
+*  Inline version of gpio_port_write().
+*
+** Input Parameters:
+*  - gpio_port: gpio_port_t
+*    Passes the port. Example: GPIO_PORTA.
+*  - gpio_port_value: uint8_t
+*    Passes the value to write to the port.
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+static inline __attribute__((always_inline)) void gpio_port_write_fast(gpio_port_t gpio_port, uint8_t gpio_port_value)
+{
+	if (__builtin_constant_p(gpio_port) && (GPIO_PORTD >= gpio_port))
+	{
+		GPIO_PORT_REG(gpio_port) = gpio_port_value;
+	}
+	else
+	{
+		(void)gpio_port_write(gpio_port, gpio_port_value);
+	}
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  gpio_pin_read_fast
+*
+** Description:
+*  Inline version of gpio_pin_read(), which returns the pin level instead of an error, so that it can be used 
+*  directly in a condition. A wrong port or pin reads as GPIO_PIN_LOW.
+*
+** Input Parameters:
+*  - gpio_port: gpio_port_t
+*    Passes the port, to which the pin belongs. Example: GPIO_PORTA.
+*  - gpio_pin: gpio_pin_t
+*    Passes the pin. Example: GPIO_PIN5
+*
+** Return Value:
+*  - gpio_pin_level_t
+*    Returns GPIO_PIN_HIGH or GPIO_PIN_LOW.
+*
+** Use Example:
+*  while (GPIO_PIN_HIGH == gpio_pin_read_fast(GPIO_PORTD, GPIO_PIN2))   // Compiles to: sbic PIND, 2
+*  {
+*  }
+*********************************************************************************************************************/
+static inline __attribute__((always_inline)) gpio_pin_level_t gpio_pin_read_fast(gpio_port_t gpio_port, 
+                                                                                  gpio_pin_t gpio_pin)
+{
+	gpio_pin_level_t pin_level = GPIO_PIN_LOW;
+	
+	if (__builtin_constant_p(gpio_port) && __builtin_constant_p(gpio_pin) && (GPIO_PORTD >= gpio_port))
+	{
+		if (0 != (GPIO_PIN_REG(gpio_port) & (uint8_t)(1U << gpio_pin)))
+		{
+			pin_level = GPIO_PIN_HIGH;
+		}
+	}
+	else
+	{
+		(void)gpio_pin_read(gpio_port, gpio_pin, &pin_level);
+	}
+	
+	return pin_level;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  gpio_pins_direction_set_fast
+*
+** Description:
+*  Inline function that sets the direction of the selected pins without changing their PORT bits, which is useful 
+*  for turning a bus around, for example to read back from a device. A constant mask of a single pin is changed with
+*  sbi or cbi, and any other mask with interrupts disabled.
+*  It has no out-of-line counterpart: with a variable port, the register address is computed at run time, and the
+*  pins are always changed with interrupts disabled, even a single one.
+*
+** Input Parameters:
+*  - gpio_port: gpio_port_t
+*    Passes the port. Example: GPIO_PORTA.
+*  - gpio_pins: uint8_t
+*    Passes the mask of the pins.
+*  - gpio_pins_direction: gpio_direction_t
+*    Passes GPIO_INPUT or GPIO_OUTPUT.
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+static inline __attribute__((always_inline)) void gpio_pins_direction_set_fast(gpio_port_t gpio_port, uint8_t gpio_pins,
+                                                                                gpio_direction_t gpio_pins_direction)
+{
+	if (__builtin_constant_p(gpio_port) && (GPIO_PORTD >= gpio_port) && GPIO_IS_SINGLE_PIN_MASK(gpio_pins))
+	{
+		if (GPIO_INPUT == gpio_pins_direction)
+		{
+			GPIO_DDR_REG(gpio_port) &= (uint8_t)(~gpio_pins);
+		}
+		else
+		{
+			GPIO_DDR_REG(gpio_port) |= gpio_pins;
+		}
+	}
+	else if (GPIO_PORTD >= gpio_port)
+	{
+		ATOMIC_BLOCK(ATOMIC_RESTORESTATE)
+		{
+			if (GPIO_INPUT == gpio_pins_direction)
+			{
+				GPIO_DDR_REG(gpio_port) &= (uint8_t)(~gpio_pins);
+			}
+			else
+			{
+				GPIO_DDR_REG(gpio_port) |= gpio_pins;
+			}
+		}
+	}
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  gpio_pin_toggle_fast
+*
+** Description:
+*  Inline version of gpio_pin_toggle(). Newer AVRs toggle a pin in one cycle when 1 is written to its PIN register
+*  bit, but the ATmega32 ignores writes to PIN, so with a constant port and pin, the PORT bit is tested and then 
+*  cleared or set with sbis, cbi and sbi, which leaves interrupts enabled and never touches the other pins.
+*
+** Input Parameters:
+*  - gpio_port: gpio_port_t
+*    Passes the port, to which the pin belongs. Example: GPIO_PORTA.
+*  - gpio_pin: gpio_pin_t
+*    Passes the pin. Example: GPIO_PIN5
+*
+** Return Value:
+*  - void
+*
+** Use Example:
+*  gpio_pin_toggle_fast(GPIO_PORTB, GPIO_PIN0);
+*********************************************************************************************************************/
+static inline __attribute__((always_inline)) void gpio_pin_toggle_fast(gpio_port_t gpio_port, gpio_pin_t gpio_pin)
+{
+	if (__builtin_constant_p(gpio_port) && __builtin_constant_p(gpio_pin) && (GPIO_PORTD >= gpio_port))
+	{
+		if (0 != (GPIO_PORT_REG(gpio_port) & (uint8_t)(1U << gpio_pin)))
+		{
+			GPIO_PORT_REG(gpio_port) &= (uint8_t)(~(1U << gpio_pin));
+		}
+		else
+		{
+			GPIO_PORT_REG(gpio_port) |= (uint8_t)(1U << gpio_pin);
+		}
+	}
+	else
+	{
+		(void)gpio_pin_toggle(gpio_port, gpio_pin);
+	}
+}
+
 
 #endif /* GPIO_ATMEGA32_H_ */
 /*********************************************************************************************************************
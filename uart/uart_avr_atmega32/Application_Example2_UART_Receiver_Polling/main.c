@@ -71,7 +71,7 @@ int main(void)
 			 data_received = uart_data_read();
 			 /* Process received data:
 			    Note that  */
-			 gpio_port_write(GPIO_PORTC, data_received); 
+			 gpio_port_write_fast(GPIO_PORTC, data_received); 
 		}
     }
 }
@@ -24,6 +24,7 @@
                                                << File Inclusions >>
 *********************************************************************************************************************/
 #include "uart_atmega32.h"
+#include "number_format.h"
 
 
 
@@ -35,12 +36,18 @@
 /* Baud Rate and Clock Frequency definition */
 #define   F_CPU                 16000000UL
 #define   BAUDRATE              9600UL
+/* Every number is sent as a line of decimal text, padded to a fixed width: */
+#define   TEXT_NUMBER_WIDTH     3
+#define   TEXT_LINE_SIZE        (NUMBER_FORMAT_U8_DIGITS + 3)  /* Digits, "\r\n" and the null terminator */
 
 
 /*********************************************************************************************************************
                                               << Variable Definitions >>
 *********************************************************************************************************************/
 static uint8_t transmission_data = INITIALIZE_TO_ZERO;
+/* The text line being transmitted, and the index of its next character: */
+static char transmission_text[TEXT_LINE_SIZE] = {INITIALIZE_TO_ZERO};
+static uint8_t transmission_text_index = INITIALIZE_TO_ZERO;
 
 
 /*********************************************************************************************************************
@@ -98,6 +105,8 @@ void uart_transmitter_init()
 *  This function works as a task that updates the data that will be sent over the UART. Provided here is just a 
 *   dummy code for demonstration purposes. The function could implement any other logic that updates the data to 
 *   be sent, for example with a temperature value obtained from a sensor connected to the microcontroller.
+*  Once the previous line has been sent, the new data is converted to a line of decimal text, which can be shown 
+*  directly by a serial terminal or by the LCD console of Example1.
 *
 ** Input Parameters:
 *  - void
@@ -107,8 +116,18 @@ void uart_transmitter_init()
 ********************************************************************************************************************/
 void transmit_data_update_task(void)
 {
+	uint8_t length = INITIALIZE_TO_ZERO;
 	
-	transmission_data = transmission_data + 1;
+	/* Checking if the previous line has been sent: */
+	if (0 == transmission_text[transmission_text_index])
+	{
+		transmission_data = transmission_data + 1;
+		length = number_format_u8(transmission_data, TEXT_NUMBER_WIDTH, NUMBER_FORMAT_PAD_SPACE, transmission_text);
+		transmission_text[length] = '\r';
+		transmission_text[length + 1] = '\n';
+		transmission_text[length + 2] = 0;
+		transmission_text_index = INITIALIZE_TO_ZERO;
+	}
 }
 
 /********************************************************************************************************************
@@ -116,7 +135,8 @@ void transmit_data_update_task(void)
 *  transmit_task
 *
 ** Description:
-*  This function works as a task to send data through the UART.
+*  This function works as a task to send the text line through the UART, one character whenever the transmitter is
+*  ready.
 *
 ** Input Parameters:
 *  - void
@@ -126,9 +146,10 @@ void transmit_data_update_task(void)
 ********************************************************************************************************************/
 void transmit_task(void)
 {
-	if (UART_READY == uart_transmitter_is_ready())
+	if ((UART_READY == uart_transmitter_is_ready()) && (0 != transmission_text[transmission_text_index]))
 	{
-		uart_data_write(transmission_data);
+		uart_data_write(transmission_text[transmission_text_index]);
+		transmission_text_index++;
 	}
 		
 }
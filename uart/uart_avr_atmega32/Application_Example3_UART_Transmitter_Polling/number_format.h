@@ -0,0 +1,176 @@
+/*********************************************************************************************************************
+* Author : Alsayed Alsisi
+* Date   : Thursday, May 06, 2021
+* Version: 1.0
+* Contact: alsayed.alsisi@gmail.com
+* License:
+* You have the right to use the file as you wish in any educational or commercial purposes under the following
+* conditions:
+* [1] This file is to be used as is. No modifications are to be made to any part of the file, including this section.
+* [2] This section is not to be removed under any circumstances.
+* [3] Parts of the file may be used separately under the condition they are not modified, and preceded by this section.
+* [4] Any bug encountered in this file or parts of it should be reported to the email address given above to be fixed.
+* [5] No warranty is expressed or implied by the publication or distribution of this source code.
+*********************************************************************************************************************/
+/*********************************************************************************************************************
+* File Information:
+** File Name:
+*  number_format.h
+*
+** Description:
+*  This file contains the public programming interfaces of the number formatting library, which converts integers to
+*  decimal or hexadecimal text for the LCD and the UART. The conversions don't use any division, since the AVR has no
+*  divide instruction: the decimal digits are found by subtracting powers of ten, and the hexadecimal digits by
+*  shifting.
+*********************************************************************************************************************/
+
+
+/*********************************************************************************************************************
+                                               << Header Guard >>
+*********************************************************************************************************************/
+#ifndef NUMBER_FORMAT_H_
+#define NUMBER_FORMAT_H_
+
+/*********************************************************************************************************************
+                                               << File Inclusions >>
+*********************************************************************************************************************/
+#include <stdint.h>
+
+/*********************************************************************************************************************
+                                               << Public Constants >>
+*********************************************************************************************************************/
+/* Maximum number of digits of each type, not including padding and the null terminator: */
+#define   NUMBER_FORMAT_U8_DIGITS     (3U)
+#define   NUMBER_FORMAT_U16_DIGITS    (5U)
+#define   NUMBER_FORMAT_U32_DIGITS    (10U)
+#define   NUMBER_FORMAT_HEX_DIGITS    (8U)
+
+/* Padding characters: */
+#define   NUMBER_FORMAT_PAD_SPACE     (' ')
+#define   NUMBER_FORMAT_PAD_ZERO      ('0')
+
+/*********************************************************************************************************************
+                                               << Public Data Types >>
+*********************************************************************************************************************/
+
+
+/*********************************************************************************************************************
+                                          << Public Variable Declarations >>
+*********************************************************************************************************************/
+
+
+/*********************************************************************************************************************
+                                   << Public Function Declarations (Programming Interfaces) >>
+*********************************************************************************************************************/
+/*********************************************************************************************************************
+** Function Name:
+*  number_format_u8
+*
+** Description:
+*  This function converts an 8 bit unsigned number to null-terminated decimal text.
+*
+** Input Parameters:
+*  - value: uint8_t
+*    Passes the number to convert.
+*  - width: uint8_t
+*    Passes the minimum number of characters. Shorter numbers are padded on the left, and longer numbers are never
+*    cut. Pass 0 for no padding.
+*  - padding: char
+*    Passes the padding character, usually NUMBER_FORMAT_PAD_SPACE or NUMBER_FORMAT_PAD_ZERO.
+*  - buffer: char*
+*    Passes the array to write the text to. It needs to hold the larger of width and NUMBER_FORMAT_U8_DIGITS, plus
+*    the null terminator.
+*
+** Return Value:
+*  - uint8_t
+*    Returns the number of characters written, not including the null terminator.
+*
+** Use Example:
+*  char text[4];
+*  number_format_u8(7, 3, NUMBER_FORMAT_PAD_ZERO, text);   // text is "007"
+*********************************************************************************************************************/
+extern uint8_t number_format_u8(uint8_t value, uint8_t width, char padding, char* buffer);
+
+/*********************************************************************************************************************
+** Function Name:
+*  number_format_u16
+*
+** Description:
+*  This function converts a 16 bit unsigned number to null-terminated decimal text.
+*
+** Input Parameters:
+*  - value: uint16_t
+*    Passes the number to convert.
+*  - width: uint8_t
+*    Passes the minimum number of characters. Shorter numbers are padded on the left, and longer numbers are never
+*    cut. Pass 0 for no padding.
+*  - padding: char
+*    Passes the padding character, usually NUMBER_FORMAT_PAD_SPACE or NUMBER_FORMAT_PAD_ZERO.
+*  - buffer: char*
+*    Passes the array to write the text to. It needs to hold the larger of width and NUMBER_FORMAT_U16_DIGITS, plus
+*    the null terminator.
+*
+** Return Value:
+*  - uint8_t
+*    Returns the number of characters written, not including the null terminator.
+*********************************************************************************************************************/
+extern uint8_t number_format_u16(uint16_t value, uint8_t width, char padding, char* buffer);
+
+/*********************************************************************************************************************
+** Function Name:
+*  number_format_u32
+*
+** Description:
+*  This function converts a 32 bit unsigned number to null-terminated decimal text. Numbers that fit in 16 bits are
+*  converted with 16 bit arithmetic.
+*
+** Input Parameters:
+*  - value: uint32_t
+*    Passes the number to convert.
+*  - width: uint8_t
+*    Passes the minimum number of characters. Shorter numbers are padded on the left, and longer numbers are never
+*    cut. Pass 0 for no padding.
+*  - padding: char
+*    Passes the padding character, usually NUMBER_FORMAT_PAD_SPACE or NUMBER_FORMAT_PAD_ZERO.
+*  - buffer: char*
+*    Passes the array to write the text to. It needs to hold the larger of width and NUMBER_FORMAT_U32_DIGITS, plus
+*    the null terminator.
+*
+** Return Value:
+*  - uint8_t
+*    Returns the number of characters written, not including the null terminator.
+*********************************************************************************************************************/
+extern uint8_t number_format_u32(uint32_t value, uint8_t width, char padding, char* buffer);
+
+/*********************************************************************************************************************
+** Function Name:
+*  number_format_hex
+*
+** Description:
+*  This function converts a number to null-terminated hexadecimal text with a fixed number of upper case digits.
+*  Only the lowest digits are kept if the number has more digits than requested.
+*
+** Input Parameters:
+*  - value: uint32_t
+*    Passes the number to convert.
+*  - digits: uint8_t
+*    Passes the number of digits, from 1 to NUMBER_FORMAT_HEX_DIGITS.
+*  - buffer: char*
+*    Passes the array to write the text to. It needs to hold the digits and the null terminator.
+*
+** Return Value:
+*  - uint8_t
+*    Returns the number of characters written, which is 0 if the number of digits is wrong.
+*
+** Use Example:
+*  char text[3];
+*  number_format_hex(0x3C, 2, text);   // text is "3C"
+*********************************************************************************************************************/
+extern uint8_t number_format_hex(uint32_t value, uint8_t digits, char* buffer);
+
+
+
+#endif /* NUMBER_FORMAT_H_ */
+/*********************************************************************************************************************
+                                               << End of File >>
+*********************************************************************************************************************/